@@ -14,6 +14,7 @@ struct NativePtr {
 using NativeWindowPtr = NativePtr;
 using NativeRendererPtr = NativePtr;
 using NativeTexturePtr = NativePtr;
+using NativeSurfacePtr = NativePtr;
 using NativeTextContextPtr = NativePtr;
 using NativeTextPtr = NativePtr;
 using NativeFontPtr = NativePtr;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace penguin::log {
+
+    // What a logging call does when the asynchronous queue is full
+    enum class LogOverflowPolicy {
+        Drop = 0, // discards the entry, only counted in Logger::get_dropped_count()
+        Block, // waits for the writer thread to make room
+        Count, // discards the entry, and the writer logs how many were dropped once it catches up
+    };
+
+    struct AsyncLogOptions {
+        std::size_t capacity = 8192; // entries, rounded up to a power of two; fixed once the queue exists
+        LogOverflowPolicy overflow = LogOverflowPolicy::Count;
+    };
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <penguin_framework/logger/log_level.hpp>
+#include <penguin_framework/logger/log_rate_limit.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+
+namespace penguin::log {
+
+    // A deferred-format logging call site, e.g. PF_LOG_INFO_FMT("Loaded {} textures in {} ms", count, ms).
+    // Each site is a function-local static, so its format string and location are written to a binary log once
+    // and every later call only records the site's ID.
+    struct LogSite {
+        const char* format;
+        LogLevel level;
+        std::source_location location;
+        mutable std::atomic<std::uint32_t> id{ 0 }; // assigned on first use, unique for the process
+        mutable LogRateBucket rate; // the site's own bucket, so rate limiting it needs no lookup
+    };
+
+    enum class LogArgType : std::uint8_t {
+        Int = 1, // signed integers and enums, 64-bit
+        UInt, // unsigned integers, 64-bit
+        Double,
+        Bool,
+        String, // 16-bit length, then the bytes
+        Pointer, // 64-bit address
+    };
+
+    // The raw arguments of a call, each a type tag and its bytes in native byte order.
+    // Strings are copied (truncated when the buffer runs out, a null C string as "(null)"), and char is recorded as a number.
+    class LogArgs {
+    public:
+        static constexpr std::size_t Capacity = 256;
+
+        template <typename T>
+        void add(const T& value) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (std::is_same_v<Type, bool>) {
+                put(LogArgType::Bool, static_cast<std::uint8_t>(value ? 1 : 0));
+            }
+            else if constexpr (std::is_enum_v<Type>) {
+                put(LogArgType::Int, static_cast<std::int64_t>(value));
+            }
+            else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+                put(LogArgType::Int, static_cast<std::int64_t>(value));
+            }
+            else if constexpr (std::is_integral_v<Type>) {
+                put(LogArgType::UInt, static_cast<std::uint64_t>(value));
+            }
+            else if constexpr (std::is_floating_point_v<Type>) {
+                put(LogArgType::Double, static_cast<double>(value));
+            }
+            else if constexpr (std::is_null_pointer_v<Type>) {
+                put(LogArgType::Pointer, std::uint64_t{ 0 });
+            }
+            else if constexpr (std::is_convertible_v<const T&, const char*>) {
+                const char* text = value;
+                put_string(text ? std::string_view(text) : std::string_view("(null)")); // a null C string is a valid argument, not a crash
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                put_string(std::string_view(value));
+            }
+            else if constexpr (std::is_pointer_v<Type>) {
+                put(LogArgType::Pointer, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value)));
+            }
+            else {
+                static_assert(!sizeof(Type*), "Deferred log arguments must be numbers, bools, enums, strings or pointers.");
+            }
+        }
+
+        const unsigned char* get_data() const noexcept { return bytes; }
+        std::size_t get_size() const noexcept { return length; }
+
+    private:
+        template <typename V>
+        void put(LogArgType type, V value) {
+            if (length + 1 + sizeof(V) > Capacity) {
+                return; // out of room, later arguments render as "{}"
+            }
+
+            bytes[length++] = static_cast<unsigned char>(type);
+            std::memcpy(bytes + length, &value, sizeof(V));
+            length += sizeof(V);
+        }
+
+        void put_string(std::string_view text) {
+            constexpr std::size_t Header_Size = 1 + sizeof(std::uint16_t);
+            if (length + Header_Size > Capacity) {
+                return;
+            }
+
+            const std::uint16_t size = static_cast<std::uint16_t>(std::min<std::size_t>(text.size(), Capacity - length - Header_Size));
+
+            bytes[length++] = static_cast<unsigned char>(LogArgType::String);
+            std::memcpy(bytes + length, &size, sizeof(size));
+            length += sizeof(size);
+            std::memcpy(bytes + length, text.data(), size);
+            length += size;
+        }
+
+        unsigned char bytes[Capacity];
+        std::size_t length = 0;
+    };
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace penguin::log {
+
+    // Per call site token bucket: a site may log burst entries at once, then per_second entries each second.
+    // Entries over the limit are dropped and reported as one "Suppressed N entries from file:line" entry, at most
+    // every report_interval seconds while the site keeps logging, or with its next entry once it calms down.
+    struct LogRateLimit {
+        bool enabled = true;
+        float per_second = 10.0f;
+        float burst = 20.0f;
+        float report_interval = 1.0f; // in seconds
+    };
+
+    // The rate limiting state of one call site, only updated with atomics so checking it never takes a lock.
+    // The bucket is kept as the time at which it is full again (a generic cell rate algorithm), in steady clock nanoseconds.
+    struct LogRateBucket {
+        std::atomic<std::int64_t> full_at_ns{ 0 };
+        std::atomic<std::int64_t> last_report_ns{ 0 };
+        std::atomic<std::uint64_t> suppressed{ 0 };
+    };
+}
@@ -3,6 +3,11 @@
 #include <penguin_api.hpp>
 
 #include <penguin_framework/logger/log_level.hpp>
+#include <penguin_framework/logger/async_log_options.hpp>
+#include <penguin_framework/logger/log_args.hpp>
+#include <penguin_framework/logger/log_rate_limit.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <source_location>
 
@@ -39,6 +44,48 @@ namespace penguin::log {
         void warning(const char* message, const std::source_location& p_location = std::source_location::current());
         void error(const char* message, const std::source_location& p_location = std::source_location::current());
 
+        // Level filtering: calls below the minimum level return before building an entry (Debug by default).
+        // PF_LOG_MIN_LEVEL removes the macros below it at compile time instead.
+
+        void set_min_level(LogLevel level);
+        LogLevel get_min_level() const;
+        [[nodiscard]] bool is_enabled(LogLevel level) const noexcept;
+
+        // Rate limiting per call site, so a warning fired every frame cannot flood the output (on by default)
+
+        void set_rate_limit(const LogRateLimit& limit);
+        LogRateLimit get_rate_limit() const;
+
+        // Deferred formatting, used through the PF_LOG_*_FMT macros: the arguments are kept raw, and only formatted
+        // (replacing each "{}") when the entry is written as text
+
+        template <typename... Args>
+        void log_fmt(const LogSite& site, const char* /* format, already in the site */, const Args&... args) {
+            if (!is_enabled(site.level)) return; // before packing the arguments
+
+            LogArgs packed;
+            (packed.add(args), ...);
+            log_deferred(site, packed.get_data(), packed.get_size());
+        }
+
+        void log_deferred(const LogSite& site, const unsigned char* args, std::size_t size);
+
+        // Binary log: PF_LOG_*_FMT calls are recorded as their site ID, timestamp, level and raw arguments without
+        // being formatted, and the penguin_logdecode tool turns the file into text. While it is open those calls are
+        // not written to the console or the text log; other calls are unaffected.
+
+        bool open_binary_log(const char* path);
+        void close_binary_log();
+
+        // Asynchronous logging: calls only queue the entry, and a background thread formats and writes them in batches,
+        // so logging never waits on console or file I/O. Errors are still kept for get_last_error_message() right away.
+        // Turning it off writes everything queued before returning.
+
+        void set_async(bool enabled, const AsyncLogOptions& options = {});
+        bool is_async() const;
+        void flush(); // waits until every entry queued so far is written, and writes out the binary log's buffer
+        std::uint64_t get_dropped_count() const; // entries discarded because the queue was full
+
         // Last error functionality
 
         bool has_error() const;
@@ -52,7 +99,55 @@ namespace penguin::log {
 
 }
 
-#define PF_LOG_DEBUG(msg) penguin::log::Logger::get_instance().debug(msg)
-#define PF_LOG_INFO(msg) penguin::log::Logger::get_instance().info(msg)
-#define PF_LOG_WARNING(msg) penguin::log::Logger::get_instance().warning(msg)
-#define PF_LOG_ERROR(msg) penguin::log::Logger::get_instance().error(msg)
\ No newline at end of file
+// Compile-time threshold: PF_LOG_* macros below it expand to nothing, arguments included.
+// 0 = Debug, 1 = Info, 2 = Warning, 3 = Error, 4 = none. Defaults to Info in release builds and Debug otherwise.
+
+#ifndef PF_LOG_MIN_LEVEL
+    #ifdef NDEBUG
+        #define PF_LOG_MIN_LEVEL 1
+    #else
+        #define PF_LOG_MIN_LEVEL 0
+    #endif
+#endif
+
+// Deferred formatting: PF_LOG_INFO_FMT("Loaded {} in {} ms", path, ms). The format must be a string literal.
+
+#define PF_LOG_EXPAND(x) x
+#define PF_LOG_FORMAT_OF(format, ...) format
+#define PF_LOG_FMT(level, ...) \
+    do { \
+        static const penguin::log::LogSite pf_log_site{ PF_LOG_EXPAND(PF_LOG_FORMAT_OF(__VA_ARGS__, unused)), level, std::source_location::current() }; \
+        penguin::log::Logger::get_instance().log_fmt(pf_log_site, __VA_ARGS__); \
+    } while (0)
+
+#if PF_LOG_MIN_LEVEL <= 0
+    #define PF_LOG_DEBUG(msg) penguin::log::Logger::get_instance().debug(msg)
+    #define PF_LOG_DEBUG_FMT(...) PF_LOG_FMT(penguin::log::LogLevel::Debug, __VA_ARGS__)
+#else
+    #define PF_LOG_DEBUG(msg) ((void)0)
+    #define PF_LOG_DEBUG_FMT(...) ((void)0)
+#endif
+
+#if PF_LOG_MIN_LEVEL <= 1
+    #define PF_LOG_INFO(msg) penguin::log::Logger::get_instance().info(msg)
+    #define PF_LOG_INFO_FMT(...) PF_LOG_FMT(penguin::log::LogLevel::Info, __VA_ARGS__)
+#else
+    #define PF_LOG_INFO(msg) ((void)0)
+    #define PF_LOG_INFO_FMT(...) ((void)0)
+#endif
+
+#if PF_LOG_MIN_LEVEL <= 2
+    #define PF_LOG_WARNING(msg) penguin::log::Logger::get_instance().warning(msg)
+    #define PF_LOG_WARNING_FMT(...) PF_LOG_FMT(penguin::log::LogLevel::Warning, __VA_ARGS__)
+#else
+    #define PF_LOG_WARNING(msg) ((void)0)
+    #define PF_LOG_WARNING_FMT(...) ((void)0)
+#endif
+
+#if PF_LOG_MIN_LEVEL <= 3
+    #define PF_LOG_ERROR(msg) penguin::log::Logger::get_instance().error(msg)
+    #define PF_LOG_ERROR_FMT(...) PF_LOG_FMT(penguin::log::LogLevel::Error, __VA_ARGS__)
+#else
+    #define PF_LOG_ERROR(msg) ((void)0)
+    #define PF_LOG_ERROR_FMT(...) ((void)0)
+#endif
@@ -33,19 +33,28 @@
 
 #include <penguin_framework/rendering/primitives/flip_modes.hpp>
 #include <penguin_framework/rendering/primitives/texture.hpp>
+#include <penguin_framework/rendering/primitives/alpha_mode.hpp>
+#include <penguin_framework/rendering/primitives/streaming_texture.hpp>
+#include <penguin_framework/rendering/primitives/animated_texture.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
 #include <penguin_framework/rendering/primitives/font_style.hpp>
+#include <penguin_framework/rendering/primitives/text_metrics.hpp>
 
 // Drawables
 
 #include <penguin_framework/rendering/drawables/sprite.hpp>
 #include <penguin_framework/rendering/drawables/text.hpp>
+#include <penguin_framework/rendering/drawables/number_renderer.hpp>
 
 // Systems
 
 #include <penguin_framework/rendering/systems/texture_loader.hpp>
 #include <penguin_framework/rendering/systems/font_loader.hpp>
 #include <penguin_framework/rendering/systems/text_context.hpp>
+#include <penguin_framework/rendering/systems/cache_stats.hpp>
+#include <penguin_framework/rendering/systems/asset_handle.hpp>
+#include <penguin_framework/rendering/systems/preload_manifest.hpp>
+#include <penguin_framework/rendering/systems/texture_info.hpp>
 #include <penguin_framework/rendering/systems/asset_manager.hpp>
 
 // Window
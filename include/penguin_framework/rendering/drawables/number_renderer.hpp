@@ -0,0 +1,58 @@
+#pragma once
+
+#include <penguin_api.hpp>
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/math/colours.hpp>
+#include <penguin_framework/math/vector2.hpp>
+
+#include <memory>
+#include <cstdint>
+
+namespace penguin::internal::rendering::drawables {
+    // Forward declaration
+    class NumberRendererImpl;
+}
+
+namespace penguin::rendering {
+    // Forward declaration
+    class Renderer;
+}
+
+namespace penguin::rendering::drawables {
+
+    // Draws numbers from a glyph atlas baked once at construction (digits, sign, separators and a few symbols).
+    // Values are formatted into a fixed buffer and drawn as a single batch of quads, so updating them every frame
+    // does not allocate. Characters outside the baked set are skipped.
+    class PENGUIN_API NumberRenderer {
+    public:
+        NumberRenderer(NativeRendererPtr renderer_ptr, std::shared_ptr<penguin::rendering::primitives::Font> font, penguin::math::Colour colour = Colours::White, penguin::math::Vector2 position = penguin::math::Vector2::Zero);
+        ~NumberRenderer();
+
+        NumberRenderer(NumberRenderer&&) noexcept;
+        NumberRenderer& operator=(NumberRenderer&&) noexcept;
+
+        // Validity checking
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        penguin::math::Vector2 get_position() const;
+        penguin::math::Colour get_colour() const;
+        penguin::math::Vector2 get_size() const;
+        const char* get_string() const;
+
+        void set_position(penguin::math::Vector2 new_position);
+        void set_colour(penguin::math::Colour new_colour);
+        void set_int(std::int64_t value);
+        void set_float(double value, int precision = 2);
+
+        NativeTexturePtr get_native_ptr() const; // the glyph atlas
+
+    private:
+        friend class penguin::rendering::Renderer; // draws the batched quads directly
+
+        std::unique_ptr<penguin::internal::rendering::drawables::NumberRendererImpl> pimpl_;
+    };
+}
@@ -5,16 +5,24 @@
 #include <penguin_framework/common/native_types.hpp>
 #include <penguin_framework/rendering/systems/text_context.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/text_metrics.hpp>
 #include <penguin_framework/math/colours.hpp>
 #include <penguin_framework/math/vector2.hpp>
+#include <penguin_framework/math/vector2i.hpp>
 
 #include <memory>
+#include <span>
 
 namespace penguin::internal::rendering::drawables {
     // Forward declaration
     struct TextImpl;
 }
 
+namespace penguin::rendering {
+    // Forward declaration
+    class Renderer;
+}
+
 namespace penguin::rendering::drawables {
 
     class PENGUIN_API Text { // TODO -> create TextContext
@@ -33,14 +41,43 @@ namespace penguin::rendering::drawables {
         penguin::math::Vector2 get_position() const;
         penguin::math::Colour get_colour() const;
         const char* get_string() const;
+        penguin::math::Vector2i get_size() const; // measured bounds of the shaped string
 
         void set_position(penguin::math::Vector2 new_position);
         void set_colour(penguin::math::Colour new_colour);
         void set_string(const char* new_string);
 
+        // Paragraph layout: line breaks are computed once and cached until the string, font or layout options change.
+
+        int get_wrap_width() const;
+        penguin::rendering::primitives::TextAlignment get_alignment() const;
+        float get_line_spacing() const;
+        std::span<const penguin::rendering::primitives::LineMetrics> get_lines() const; // for hit-testing, relative to the text position
+
+        void set_wrap_width(int new_wrap_width); // in pixels, 0 only breaks on newlines
+        void set_alignment(penguin::rendering::primitives::TextAlignment new_alignment);
+        void set_line_spacing(float new_line_spacing); // multiplier on the font's line skip
+
+        // Scaled drawing: the text is rasterised once at the font size and scaled when drawn, so zoomed or resized
+        // text does not need the font opened at every size. Sizes and line metrics stay in unscaled font pixels.
+
+        float get_scale() const;
+        void set_scale(float new_scale);
+
+        // Static text baking: rasterises the string once into a texture that is drawn as a single quad.
+        // Changing the string re-bakes it, changing the colour does not.
+
+        void bake(NativeRendererPtr renderer_ptr);
+        void unbake();
+        bool is_baked() const;
+
         NativeTextPtr get_native_ptr() const;
 
     private:
+        friend class penguin::rendering::Renderer; // draws the baked texture directly
+
+        void rebake_if_needed(); // keeps baked text in sync with its layout
+
         std::unique_ptr<penguin::internal::rendering::drawables::TextImpl> pimpl_;
     };
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace penguin::rendering::primitives {
+
+	// How a texture's colour channels relate to its alpha channel
+	enum class AlphaMode : uint32_t {
+		Straight = 0, // colours as stored in the image, blended with SDL_BLENDMODE_BLEND
+		Premultiplied = 1 // colours multiplied by alpha once at upload, blended with SDL_BLENDMODE_BLEND_PREMULTIPLIED (cheaper, no fringes when scaled)
+	};
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <penguin_api.hpp>
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/math/rect2.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+#include <penguin_framework/rendering/primitives/texture.hpp>
+
+#include <memory>
+#include <span>
+
+namespace penguin::internal::rendering::primitives {
+	// Forward declaration
+	struct AnimatedTextureImpl;
+}
+
+namespace penguin::rendering::primitives {
+
+	// One frame of an animation: the atlas page holding it and where, e.g. for Sprite::set_texture() and set_texture_region()
+	struct AnimationFrame {
+		std::shared_ptr<Texture> texture;
+		penguin::math::Rect2 region;
+		int delay_ms = 0;
+
+		[[nodiscard]] explicit operator bool() const noexcept { return texture != nullptr; }
+	};
+
+	// An animated image (e.g. a GIF), decoded on a background thread from construction.
+	//
+	// Frames are packed into atlas pages as they are first shown, rather than uploaded all at once, and each decoded frame
+	// is freed once it is on the GPU. The delay table drives playback:
+	//   AnimationFrame frame = animation.get_frame(animation.get_frame_at(elapsed_ms));
+	//   sprite.set_texture(frame.texture);
+	//   sprite.set_texture_region(frame.region);
+	//
+	// Everything except is_valid() and is_ready() waits for decoding to finish. Render thread only, like Texture.
+	class PENGUIN_API AnimatedTexture {
+	public:
+		AnimatedTexture(NativeRendererPtr renderer_ptr, const char* path);
+		~AnimatedTexture();
+
+		AnimatedTexture(AnimatedTexture&&) noexcept;
+		AnimatedTexture& operator=(AnimatedTexture&&) noexcept;
+
+		// Validity checking
+
+		[[nodiscard]] bool is_valid() const noexcept; // false once decoding has failed
+		[[nodiscard]] explicit operator bool() const noexcept;
+
+		bool is_ready() const; // decoding finished, so nothing below waits
+
+		// Frames
+
+		AnimationFrame get_frame(int index); // uploads the frame into its atlas page the first time
+		int get_frame_at(int time_ms, bool loop = true) const; // the frame shown time_ms into the animation
+
+		// Getters
+
+		int get_frame_count() const;
+		penguin::math::Vector2i get_frame_size() const;
+		std::span<const int> get_frame_delays() const; // in milliseconds, 10 ms or less plays at 100 ms (as browsers do)
+		int get_duration() const; // of one loop, in milliseconds
+
+	private:
+		std::unique_ptr<penguin::internal::rendering::primitives::AnimatedTextureImpl> pimpl_;
+	};
+}
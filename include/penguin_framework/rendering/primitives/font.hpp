@@ -3,8 +3,10 @@
 #include <penguin_api.hpp>
 
 #include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/rendering/primitives/text_metrics.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace penguin::internal::rendering::primitives {
     // Forward declaration
@@ -15,7 +17,10 @@ namespace penguin::rendering::primitives {
 
     class PENGUIN_API Font {
     public:
+        static constexpr const char* Ascii_Charset = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+
         Font(const char* path, float size = 12.0f, int outline = 1);
+        Font(std::shared_ptr<const std::vector<unsigned char>> font_data, float size = 12.0f, int outline = 1); // opens the font over an in-memory file, which the font keeps alive
         ~Font();
 
         Font(Font&&) noexcept;
@@ -46,6 +51,24 @@ namespace penguin::rendering::primitives {
 
         void clear();
 
+        // Signed distance field glyphs: one rasterisation holds the glyph shape at any size.
+        // The distance values are stored in the alpha channel and need a shader to be drawn sharply, so this is meant
+        // for custom pipelines that use the native font. To draw text at several sizes, scale a Text instead.
+
+        void set_sdf(bool enabled);
+        bool is_sdf() const;
+
+        // Rasterises every glyph of the UTF-8 charset into the font's glyph cache up front, so the first frame showing
+        // new text does not stall on it. Changing the size or outline clears the cache. Returns the number of glyphs cached.
+
+        int prewarm(const char* charset = Ascii_Charset);
+
+        // Measures a UTF-8 string from the font's cached glyph advances and kerning, breaking lines at the wrap width
+        // (0 only breaks on newlines). No text object is created, and the second overload reuses the storage of the result.
+
+        TextMetrics measure(const char* str, int wrap_width = 0) const;
+        bool measure(const char* str, int wrap_width, TextMetrics& metrics) const;
+
         NativeFontPtr get_native_ptr();
 
     private:
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <penguin_api.hpp>
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/math/rect2i.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+#include <penguin_framework/rendering/primitives/texture.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace penguin::internal::rendering::primitives {
+	// Forward declaration
+	struct StreamingTextureImpl;
+}
+
+namespace penguin::rendering::primitives {
+
+	// Pixels of a locked region, 32-bit 0xAARRGGBB (the layout Colour::from_argb() reads)
+	struct PixelBuffer {
+		std::span<std::uint32_t> pixels; // the rows of the region, pitch pixels apart
+		int pitch = 0; // in pixels
+		penguin::math::Vector2i size;
+
+		[[nodiscard]] std::span<std::uint32_t> get_row(int y) const { return pixels.subspan(static_cast<std::size_t>(y) * pitch, static_cast<std::size_t>(size.x)); }
+		[[nodiscard]] explicit operator bool() const noexcept { return !pixels.empty(); }
+	};
+
+	// A texture whose pixels are rewritten from the CPU, e.g. a minimap or a procedural effect, without creating new textures.
+	//
+	// Without triple buffering, lock()/unlock() map the texture itself and must be called on the render thread.
+	// With triple buffering, the pixels are written into one of three CPU-side frames, so a producer (on any one thread)
+	// never waits for the renderer: unlock() publishes the frame, and upload() on the render thread copies the newest
+	// published frame into the texture before it is drawn. Frames published faster than they are uploaded are skipped.
+	class PENGUIN_API StreamingTexture {
+	public:
+		StreamingTexture(NativeRendererPtr renderer_ptr, penguin::math::Vector2i size, bool triple_buffered = false);
+		~StreamingTexture();
+
+		StreamingTexture(StreamingTexture&&) noexcept;
+		StreamingTexture& operator=(StreamingTexture&&) noexcept;
+
+		// Validity checking
+
+		[[nodiscard]] bool is_valid() const noexcept;
+		[[nodiscard]] explicit operator bool() const noexcept;
+
+		// Writing pixels
+
+		PixelBuffer lock(); // the whole texture, write-only: every pixel must be written, as the old contents are not kept
+		PixelBuffer lock(const penguin::math::Rect2i& rect); // only the region changes, the rest of the texture keeps its pixels
+		void unlock();
+
+		bool upload(); // triple buffered only: uploads the newest published frame, returns false if there was none
+
+		// Getters
+
+		std::shared_ptr<Texture> get_texture() const; // to draw it, e.g. through a Sprite
+		penguin::math::Vector2i get_size() const;
+		bool is_triple_buffered() const;
+		bool is_locked() const;
+
+	private:
+		std::unique_ptr<penguin::internal::rendering::primitives::StreamingTextureImpl> pimpl_;
+	};
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <penguin_framework/math/rect2.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace penguin::rendering::primitives {
+
+	enum class TextAlignment : int {
+		Left = 0,
+		Center = 1,
+		Right = 2
+	};
+
+	// A single laid out line of a string. The bounds are relative to the top-left corner of the text.
+	struct LineMetrics {
+		std::size_t offset; // byte offset of the line in the string
+		std::size_t length; // length of the line in bytes, excluding the whitespace it was broken on
+		penguin::math::Rect2 bounds;
+	};
+
+	// Measured bounds of a string and its lines, without shaping it into a drawable text.
+	struct TextMetrics {
+		penguin::math::Vector2i size;
+		std::vector<LineMetrics> lines;
+	};
+}
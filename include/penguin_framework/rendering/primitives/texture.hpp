@@ -7,6 +7,7 @@
 #include <penguin_framework/math/circle2.hpp>
 #include <penguin_framework/math/colours.hpp>
 #include <penguin_framework/math/vector2i.hpp>
+#include <penguin_framework/rendering/primitives/alpha_mode.hpp>
 
 #include <memory>
 #include <vector>
@@ -20,7 +21,10 @@ namespace penguin::rendering::primitives {
 
 	class PENGUIN_API Texture {
 	public:
-		Texture(NativeRendererPtr renderer_ptr, const char* path);
+		// Images are converted once to the renderer's native pixel format on upload, so drawing them needs no conversion
+		Texture(NativeRendererPtr renderer_ptr, const char* path, AlphaMode alpha_mode = AlphaMode::Straight);
+		Texture(NativeRendererPtr renderer_ptr, NativeSurfacePtr surface_ptr, AlphaMode alpha_mode = AlphaMode::Straight); // uploads an already decoded image, the surface is not taken over
+		Texture(NativeRendererPtr renderer_ptr, penguin::math::Vector2i size); // blank 32-bit ARGB texture with streaming access, written through a StreamingTexture
 		~Texture();
 
 		Texture(Texture&&) noexcept;
@@ -33,6 +37,7 @@ namespace penguin::rendering::primitives {
 
 		NativeTexturePtr get_native_ptr() const;
 		penguin::math::Vector2i get_size() const;
+		AlphaMode get_alpha_mode() const;
 
 	private:
 		std::unique_ptr<penguin::internal::rendering::primitives::TextureImpl> pimpl_;
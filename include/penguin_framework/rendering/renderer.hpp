@@ -6,6 +6,7 @@
 #include <penguin_framework/window/window.hpp>
 #include <penguin_framework/rendering/drawables/sprite.hpp>
 #include <penguin_framework/rendering/drawables/text.hpp>
+#include <penguin_framework/rendering/drawables/number_renderer.hpp>
 #include <penguin_framework/math/rect2.hpp>
 #include <penguin_framework/math/vector2.hpp>
 #include <penguin_framework/math/circle2.hpp>
@@ -63,6 +64,7 @@ namespace penguin::rendering {
 		// Drawing functions for Text
 		
 		void draw_text(const drawables::Text& txt);
+		void draw_number(const drawables::NumberRenderer& num);
 
 		NativeRendererPtr get_native_ptr() const;
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace penguin::rendering::systems {
+
+	// 64-bit FNV-1a of an asset path, usable at compile time
+	constexpr std::uint64_t hash_asset_path(std::string_view path) noexcept {
+		std::uint64_t hash = 14695981039346656037ull; // FNV-1a offset basis
+
+		for (char c : path) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull; // FNV-1a prime
+		}
+
+		return hash;
+	}
+
+	// A hashed asset path. Paths known up front can be hashed at compile time:
+	//   constexpr AssetId Player_Id("assets/player.png");
+	struct AssetId {
+		std::uint64_t hash = 0;
+
+		constexpr AssetId() noexcept = default;
+		constexpr AssetId(std::string_view path) noexcept : hash(hash_asset_path(path)) {}
+
+		constexpr bool operator==(const AssetId& other) const noexcept = default;
+	};
+
+	// Index of an interned texture in the asset manager's handle table
+
+	struct TextureHandle {
+		static constexpr std::uint32_t Invalid_Index = 0xFFFFFFFFu;
+
+		std::uint32_t index = Invalid_Index;
+
+		[[nodiscard]] constexpr bool is_valid() const noexcept { return index != Invalid_Index; }
+		[[nodiscard]] constexpr explicit operator bool() const noexcept { return is_valid(); }
+
+		constexpr bool operator==(const TextureHandle& other) const noexcept = default;
+	};
+
+	// Index of an interned font (path, size, outline and style) in the asset manager's handle table
+
+	struct FontHandle {
+		static constexpr std::uint32_t Invalid_Index = 0xFFFFFFFFu;
+
+		std::uint32_t index = Invalid_Index;
+
+		[[nodiscard]] constexpr bool is_valid() const noexcept { return index != Invalid_Index; }
+		[[nodiscard]] constexpr explicit operator bool() const noexcept { return is_valid(); }
+
+		constexpr bool operator==(const FontHandle& other) const noexcept = default;
+	};
+}
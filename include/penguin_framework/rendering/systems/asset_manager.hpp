@@ -5,8 +5,15 @@
 #include <penguin_framework/rendering/renderer.hpp>
 #include <penguin_framework/rendering/primitives/texture.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/font_style.hpp>
+#include <penguin_framework/rendering/systems/cache_stats.hpp>
+#include <penguin_framework/rendering/systems/asset_handle.hpp>
+#include <penguin_framework/rendering/systems/preload_manifest.hpp>
+#include <penguin_framework/rendering/systems/texture_info.hpp>
 
 #include <memory>
+#include <future>
+#include <cstddef>
 
 namespace penguin::internal::rendering::systems {
 	// Forward declaration
@@ -33,7 +40,70 @@ namespace penguin::rendering::systems {
 		// Various load functions
 
 		std::shared_ptr<primitives::Texture> load_texture(const char* path);
-		std::shared_ptr<primitives::Font> load_font(const char* path, float size = 12.0f, int outline = 1);
+		std::shared_ptr<primitives::Font> load_font(const char* path, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal,
+			const char* prewarm_charset = nullptr); // rasterises the charset up front when set, e.g. primitives::Font::Ascii_Charset
+
+		// Rasterises an SVG for drawing at target_size. Sizes are rounded up to a bucket (at most 1/8 larger), and each
+		// (path, bucket) is cached, so small resolution or DPI changes reuse a texture instead of rasterising the SVG again.
+		// Other images ignore target_size and load as load_texture(path) does.
+
+		std::shared_ptr<primitives::Texture> load_texture(const char* path, penguin::math::Vector2i target_size);
+
+		// Interned handles: the path is hashed once, after which get_texture()/get_font() are an index into a dense table.
+		// Interned assets stay loaded (and outside the memory budgets) for the asset manager's lifetime.
+		// find_*_handle() takes an AssetId that can be hashed at compile time, for handles interned earlier.
+
+		TextureHandle load_texture_handle(const char* path); // an invalid handle if the texture cannot be loaded
+		FontHandle load_font_handle(const char* path, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal);
+		TextureHandle find_texture_handle(AssetId id) const;
+		FontHandle find_font_handle(AssetId id, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal) const;
+
+		const std::shared_ptr<primitives::Texture>& get_texture(TextureHandle handle) const; // nullptr for an invalid handle
+		const std::shared_ptr<primitives::Font>& get_font(FontHandle handle) const;
+
+		// Asynchronous loading: files are read and decoded on worker threads, and the results are uploaded by process_uploads(),
+		// which must be called on the render thread (e.g. once per frame). The futures become ready during that call,
+		// so never wait on them from the render thread before processing the uploads.
+		// Requests may come from any thread, and requesting an asset that is still loading shares the same load.
+
+		std::shared_future<std::shared_ptr<primitives::Texture>> load_texture_async(const char* path);
+		std::shared_future<std::shared_ptr<primitives::Font>> load_font_async(const char* path, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal);
+
+		std::size_t process_uploads(float budget_ms = 2.0f); // uploads decoded assets until the budget runs out (at least one), returns how many
+		std::size_t get_pending_uploads() const; // decoded assets waiting for process_uploads()
+
+		// Loads every asset in the manifest, decoding them in parallel on the worker threads while this (render) thread
+		// uploads them. Blocks until all of them are loaded or have failed, calling on_progress on this thread after each one,
+		// so the callback can draw a loading screen. Returns how many assets loaded.
+		std::size_t preload(const PreloadManifest& manifest, const PreloadCallback& on_progress = {});
+
+		// Packed archives built with the penguin_pack tool. An asset path under mount_point (e.g. "assets/ui/button.png"
+		// for mount point "assets") is looked up in the archive first, newest mount first, before falling back to the disk.
+
+		bool mount_archive(const char* archive_path, const char* mount_point = "");
+
+		// Reads only the header of a PNG, JPEG, BMP or GIF image (from a mounted archive or the disk) to get its size and format,
+		// e.g. to lay out a screen before its textures load. Returns an info with ImageFormat::Unknown if it cannot be read.
+
+		TextureInfo probe_texture(const char* path);
+
+		// Disk cache of decoded images: the first load of an image stores its pixels in the renderer's format under directory,
+		// and later runs upload them without decoding the image again. Entries are checked against the source file's
+		// modification time and contents. nullptr or "" disables the cache (the default).
+
+		bool set_texture_disk_cache(const char* directory);
+
+		// Textures loaded from then on are uploaded with this alpha mode (Straight by default)
+		void set_texture_alpha_mode(primitives::AlphaMode mode);
+
+		// Memory budgets (0 means unlimited): cached assets that nothing else uses are released least recently used first
+
+		void set_texture_memory_budget(std::size_t bytes);
+		void set_font_memory_budget(std::size_t bytes);
+		void trim(); // releases every cached asset that nothing else uses
+
+		CacheStats get_texture_stats() const;
+		CacheStats get_font_stats() const;
 
 	private:
 		std::unique_ptr<penguin::internal::rendering::systems::AssetManagerImpl> pimpl_;
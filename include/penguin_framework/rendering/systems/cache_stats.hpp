@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace penguin::rendering::systems {
+
+	// Snapshot of an asset cache's memory use and effectiveness
+	struct CacheStats {
+		std::size_t resident_bytes = 0; // estimated memory held by the cached assets
+		std::size_t budget_bytes = 0; // 0 means unlimited
+		std::size_t entries = 0;
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+	};
+}
@@ -4,8 +4,13 @@
 
 #include <penguin_framework/common/native_types.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/font_style.hpp>
+
+#include <penguin_framework/rendering/systems/cache_stats.hpp>
 
 #include <memory>
+#include <cstddef>
+#include <vector>
 
 namespace penguin::internal::rendering::systems {
 	// Forward declaration
@@ -29,8 +34,19 @@ namespace penguin::rendering::systems {
 		[[nodiscard]] bool is_valid() const noexcept;
 		[[nodiscard]] explicit operator bool() const noexcept;
 
-		// Load function
-		std::shared_ptr<primitives::Font> load(const char* path, float size = 12.0f, int outline = 1);
+		// Load function (fonts are cached per path, size, outline and style, and share one in-memory copy of each file)
+		std::shared_ptr<primitives::Font> load(const char* path, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal);
+		std::shared_ptr<primitives::Font> load(const char* path, std::shared_ptr<const std::vector<unsigned char>> font_data, float size = 12.0f, int outline = 1,
+			primitives::FontStyle style = primitives::FontStyle::Normal); // uses the file contents read elsewhere (e.g. on a worker thread) if the file is not in memory yet
+
+		std::shared_ptr<primitives::Font> find(const char* path, float size = 12.0f, int outline = 1, primitives::FontStyle style = primitives::FontStyle::Normal) const; // cache lookup only, nullptr on a miss
+
+		// Memory budget: once the cached fonts exceed it, the ones nothing else uses are released least recently used first
+
+		void set_memory_budget(std::size_t bytes); // 0 means unlimited (the default)
+		std::size_t get_memory_budget() const;
+		void trim(); // releases every cached font that nothing else uses
+		CacheStats get_stats() const;
 
 	private:
 		std::unique_ptr<penguin::internal::rendering::systems::FontLoaderImpl> pimpl_;
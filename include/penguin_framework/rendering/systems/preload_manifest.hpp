@@ -0,0 +1,35 @@
+#pragma once
+
+#include <penguin_framework/rendering/primitives/font_style.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace penguin::rendering::systems {
+
+	struct FontPreload {
+		std::string path;
+		float size = 12.0f;
+		int outline = 1;
+		primitives::FontStyle style = primitives::FontStyle::Normal;
+	};
+
+	// The assets a level (or screen) needs, loaded together by AssetManager::preload()
+	struct PreloadManifest {
+		std::vector<std::string> textures;
+		std::vector<FontPreload> fonts;
+	};
+
+	struct PreloadProgress {
+		std::size_t loaded = 0;
+		std::size_t failed = 0;
+		std::size_t total = 0;
+
+		[[nodiscard]] float get_fraction() const noexcept { return total ? static_cast<float>(loaded + failed) / static_cast<float>(total) : 1.0f; }
+		[[nodiscard]] bool is_done() const noexcept { return loaded + failed == total; }
+	};
+
+	using PreloadCallback = std::function<void(const PreloadProgress&)>;
+}
@@ -4,17 +4,25 @@
 
 #include <penguin_framework/common/native_types.hpp>
 #include <memory>
+#include <cstddef>
 
 namespace penguin::internal::rendering::systems {
     // Forward declaration
     struct TextContextImpl;
 }
 
+namespace penguin::rendering::drawables {
+    // Forward declaration
+    class Text;
+}
+
 namespace penguin::rendering::systems {
 
     class PENGUIN_API TextContext {
     public:
-        TextContext(NativeRendererPtr renderer);
+        static constexpr std::size_t Default_Layout_Cache_Capacity = 256;
+
+        TextContext(NativeRendererPtr renderer, std::size_t layout_cache_capacity = Default_Layout_Cache_Capacity);
         ~TextContext();
 
         // Move semantics
@@ -27,9 +35,17 @@ namespace penguin::rendering::systems {
         [[nodiscard]] bool is_valid() const noexcept;
         [[nodiscard]] explicit operator bool() const noexcept;
 
+        // Shaped-text layout cache (shared by every Text created with this context)
+
+        std::size_t get_layout_cache_size() const;
+        void set_layout_cache_capacity(std::size_t new_capacity);
+        void clear_layout_cache();
+
         NativeTextContextPtr get_native_ptr() const;
 
     private:
+        friend class penguin::rendering::drawables::Text; // Text acquires its layouts from the context's cache
+
         std::unique_ptr<penguin::internal::rendering::systems::TextContextImpl> pimpl_;
     };
 }
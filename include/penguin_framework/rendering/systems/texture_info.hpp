@@ -0,0 +1,24 @@
+#pragma once
+
+#include <penguin_framework/math/vector2i.hpp>
+
+#include <cstdint>
+
+namespace penguin::rendering::systems {
+
+	enum class ImageFormat : uint32_t {
+		Unknown = 0,
+		Png = 1,
+		Jpeg = 2,
+		Bmp = 3,
+		Gif = 4
+	};
+
+	// What an image file's header says about it, read without decoding the image
+	struct TextureInfo {
+		penguin::math::Vector2i size = penguin::math::Vector2i(0, 0);
+		ImageFormat format = ImageFormat::Unknown;
+
+		[[nodiscard]] explicit operator bool() const noexcept { return format != ImageFormat::Unknown; }
+	};
+}
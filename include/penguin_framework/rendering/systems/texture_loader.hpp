@@ -5,7 +5,11 @@
 #include <penguin_framework/common/native_types.hpp>
 #include <penguin_framework/rendering/primitives/texture.hpp>
 
+#include <penguin_framework/rendering/systems/cache_stats.hpp>
+
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 
 namespace penguin::internal::rendering::systems {
 	// Forward declaration
@@ -29,8 +33,24 @@ namespace penguin::rendering::systems {
 		[[nodiscard]] bool is_valid() const noexcept;
 		[[nodiscard]] explicit operator bool() const noexcept;
 
-		// Load function
-		std::shared_ptr<primitives::Texture> load(NativeRendererPtr renderer, const char* path);
+		// Load functions
+		// Textures are shared by content: an image that is identical to a cached one (under any path) reuses its texture.
+
+		std::shared_ptr<primitives::Texture> load(NativeRendererPtr renderer, const char* path); // compares the files' contents before decoding
+		std::shared_ptr<primitives::Texture> load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded); // uploads an image decoded elsewhere, compared by its pixels
+		std::shared_ptr<primitives::Texture> load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded, std::uint64_t content_hash); // compared by a hash of the source file
+
+		std::shared_ptr<primitives::Texture> find(const char* path) const; // cache lookup only, nullptr on a miss
+
+		void set_alpha_mode(primitives::AlphaMode mode); // used by the textures loaded from then on (Straight by default)
+		primitives::AlphaMode get_alpha_mode() const;
+
+		// Memory budget: once the cached textures exceed it, the ones nothing else uses are released least recently used first
+
+		void set_memory_budget(std::size_t bytes); // 0 means unlimited (the default)
+		std::size_t get_memory_budget() const;
+		void trim(); // releases every cached texture that nothing else uses
+		CacheStats get_stats() const;
 
 	private:
 		std::unique_ptr<penguin::internal::rendering::systems::TextureLoaderImpl> pimpl_;
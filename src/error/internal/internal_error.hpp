@@ -22,6 +22,7 @@ namespace penguin::internal::error {
         Sprite_Creation_Failed,
         Font_Creation_Failed,
         Text_Creation_Failed,
+        Number_Renderer_Creation_Failed,
         Event_Creation_Failed,
         Input_System_Creation_Failed,
         //Audio_Device_Open_Failed,
@@ -71,6 +72,8 @@ namespace penguin::internal::error {
                 return "Font_Creation_Failed";
             case ErrorCode::Text_Creation_Failed:
                 return "Text_Creation_Failed";
+            case ErrorCode::Number_Renderer_Creation_Failed:
+                return "Number_Renderer_Creation_Failed";
             case ErrorCode::Asset_Manager_Init_Failed:
                 return "Asset_Manager_Creation_Failed";
             case ErrorCode::Texture_Loader_Init_Failed:
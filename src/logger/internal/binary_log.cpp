@@ -0,0 +1,287 @@
+#include <logger/internal/binary_log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+
+namespace penguin::internal::log {
+
+    namespace {
+        std::atomic<std::uint32_t> next_site_id{ 1 }; // 0 means not assigned yet
+
+        template <typename T>
+        bool read_arg(const unsigned char* args, std::size_t size, std::size_t& offset, T& value) {
+            if (size - offset < sizeof(T)) {
+                return false;
+            }
+
+            std::memcpy(&value, args + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        // Appends the next argument as text, false when there are none left
+        bool render_next_arg(std::string& out, const unsigned char* args, std::size_t size, std::size_t& offset) {
+            if (offset >= size) {
+                return false;
+            }
+
+            const penguin::log::LogArgType type = static_cast<penguin::log::LogArgType>(args[offset++]);
+            char digits[32];
+
+            switch (type) {
+                case penguin::log::LogArgType::Int: {
+                    std::int64_t value;
+                    if (!read_arg(args, size, offset, value)) return false;
+                    out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+                    return true;
+                }
+                case penguin::log::LogArgType::UInt: {
+                    std::uint64_t value;
+                    if (!read_arg(args, size, offset, value)) return false;
+                    out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+                    return true;
+                }
+                case penguin::log::LogArgType::Double: {
+                    double value;
+                    if (!read_arg(args, size, offset, value)) return false;
+                    out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+                    return true;
+                }
+                case penguin::log::LogArgType::Bool: {
+                    std::uint8_t value;
+                    if (!read_arg(args, size, offset, value)) return false;
+                    out += value ? "true" : "false";
+                    return true;
+                }
+                case penguin::log::LogArgType::String: {
+                    std::uint16_t length;
+                    if (!read_arg(args, size, offset, length) || size - offset < length) return false;
+                    out.append(reinterpret_cast<const char*>(args + offset), length);
+                    offset += length;
+                    return true;
+                }
+                case penguin::log::LogArgType::Pointer: {
+                    std::uint64_t value;
+                    if (!read_arg(args, size, offset, value)) return false;
+                    out += "0x";
+                    out.append(digits, std::to_chars(digits, digits + sizeof(digits), value, 16).ptr);
+                    return true;
+                }
+                default:
+                    offset = size; // unknown tag, the rest cannot be parsed
+                    return false;
+            }
+        }
+    }
+
+    std::uint32_t get_log_site_id(const penguin::log::LogSite& site) {
+        std::uint32_t id = site.id.load(std::memory_order_acquire);
+
+        if (id == 0) {
+            std::uint32_t new_id = next_site_id.fetch_add(1, std::memory_order_relaxed);
+            if (site.id.compare_exchange_strong(id, new_id, std::memory_order_acq_rel)) {
+                id = new_id;
+            } // otherwise another thread assigned it first, and id now holds that one
+        }
+
+        return id;
+    }
+
+    std::string render_log_format(std::string_view format, const unsigned char* args, std::size_t size) {
+        std::string out;
+        out.reserve(format.size() + size);
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < format.size(); ++i) {
+            const char c = format[i];
+            const bool doubled = i + 1 < format.size() && format[i + 1] == c;
+
+            if (c == '{' && i + 1 < format.size() && format[i + 1] == '}') {
+                if (!render_next_arg(out, args, size, offset)) {
+                    out += "{}"; // more placeholders than arguments
+                }
+                ++i;
+            }
+            else if ((c == '{' || c == '}') && doubled) {
+                out += c;
+                ++i;
+            }
+            else {
+                out += c;
+            }
+        }
+
+        return out;
+    }
+
+    // Writer
+
+    bool BinaryLogWriter::open(const char* path) {
+        close();
+
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+
+        buffer.reserve(Flush_Bytes * 2);
+        written_sites.clear();
+        last_flush = std::chrono::steady_clock::now();
+
+        buffer.insert(buffer.end(), Binary_Log_Magic, Binary_Log_Magic + sizeof(Binary_Log_Magic));
+        put(Binary_Log_Version);
+        put(Binary_Log_Byte_Order);
+
+        return true;
+    }
+
+    void BinaryLogWriter::close() {
+        if (file.is_open()) {
+            flush();
+            file.close();
+        }
+    }
+
+    void BinaryLogWriter::write_event(const penguin::log::LogSite& site, std::uint64_t timestamp_ns, const unsigned char* args, std::size_t size) {
+        const std::uint32_t id = get_log_site_id(site);
+
+        if (id >= written_sites.size() || !written_sites[id]) {
+            write_site(site, id);
+        }
+
+        put(BinaryLogRecord::Event);
+        put(id);
+        put(static_cast<std::uint8_t>(site.level));
+        put(timestamp_ns);
+        put(static_cast<std::uint16_t>(size));
+        buffer.insert(buffer.end(), args, args + size);
+
+        if (buffer.size() >= Flush_Bytes || site.level == penguin::log::LogLevel::Error
+            || std::chrono::steady_clock::now() - last_flush >= Flush_Interval) {
+            flush();
+        }
+    }
+
+    void BinaryLogWriter::flush() {
+        if (!buffer.empty()) {
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+        file.flush();
+        last_flush = std::chrono::steady_clock::now();
+    }
+
+    void BinaryLogWriter::write_site(const penguin::log::LogSite& site, std::uint32_t id) {
+        if (id >= written_sites.size()) {
+            written_sites.resize(id + 1, false);
+        }
+        written_sites[id] = true;
+
+        put(BinaryLogRecord::Site);
+        put(id);
+        put(static_cast<std::uint8_t>(site.level));
+        put(static_cast<std::uint32_t>(site.location.line()));
+        put(static_cast<std::uint32_t>(site.location.column()));
+        put_string(site.location.file_name());
+        put_string(site.location.function_name());
+        put_string(site.format);
+    }
+
+    void BinaryLogWriter::put_string(std::string_view text) {
+        const std::uint16_t size = static_cast<std::uint16_t>(std::min<std::size_t>(text.size(), 0xFFFF));
+        put(size);
+        buffer.insert(buffer.end(), text.begin(), text.begin() + size);
+    }
+
+    // Reader
+
+    bool BinaryLogReader::open(const char* path) {
+        file.open(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+
+        char magic[4];
+        std::uint32_t version = 0;
+        std::uint32_t byte_order = 0;
+
+        return read_bytes(magic, sizeof(magic)) && std::memcmp(magic, Binary_Log_Magic, sizeof(magic)) == 0
+            && read(version) && version == Binary_Log_Version
+            && read(byte_order) && byte_order == Binary_Log_Byte_Order; // written on a machine with another byte order otherwise
+    }
+
+    bool BinaryLogReader::next(DecodedLogEvent& event) {
+        BinaryLogRecord type;
+
+        while (read(type)) {
+            if (type == BinaryLogRecord::Site) {
+                std::uint32_t id, line, column;
+                std::uint8_t level;
+                Site site;
+
+                if (!read(id) || !read(level) || !read(line) || !read(column)
+                    || !read_string(site.file) || !read_string(site.function) || !read_string(site.format)) {
+                    truncated = true;
+                    return false;
+                }
+
+                site.level = static_cast<penguin::log::LogLevel>(level);
+                site.line = static_cast<int>(line);
+                site.column = static_cast<int>(column);
+                sites[id] = std::move(site);
+                continue;
+            }
+
+            if (type != BinaryLogRecord::Event) {
+                truncated = true; // not a record, the rest cannot be parsed
+                return false;
+            }
+
+            std::uint32_t id;
+            std::uint8_t level;
+            std::uint16_t size;
+            unsigned char args[penguin::log::LogArgs::Capacity];
+
+            if (!read(id) || !read(level) || !read(event.timestamp_ns) || !read(size) || size > sizeof(args) || !read_bytes(args, size)) {
+                truncated = true;
+                return false;
+            }
+
+            auto it = sites.find(id);
+            if (it == sites.end()) {
+                truncated = true;
+                return false;
+            }
+
+            const Site& site = it->second;
+            event.level = static_cast<penguin::log::LogLevel>(level);
+            event.message = render_log_format(site.format, args, size);
+            event.file = site.file;
+            event.line = site.line;
+            event.column = site.column;
+            event.function = site.function;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool BinaryLogReader::read_bytes(void* out, std::size_t size) {
+        return static_cast<bool>(file.read(static_cast<char*>(out), static_cast<std::streamsize>(size)));
+    }
+
+    bool BinaryLogReader::read_string(std::string& out) {
+        std::uint16_t size;
+        if (!read(size)) {
+            return false;
+        }
+
+        out.resize(size);
+        return read_bytes(out.data(), size);
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <penguin_framework/logger/log_level.hpp>
+#include <penguin_framework/logger/log_args.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace penguin::internal::log {
+
+    // Binary log layout (native byte order, checked through the byte order mark):
+    //   header: "PFLG", u32 version, u32 byte order mark
+    //   site record:  u8 1, u32 id, u8 level, u32 line, u32 column, then file, function and format (u16 length + bytes each)
+    //   event record: u8 2, u32 site id, u8 level, u64 nanoseconds since the epoch, u16 argument bytes, then the arguments
+    // A site record is written before the first event that uses it.
+
+    constexpr char Binary_Log_Magic[4] = { 'P', 'F', 'L', 'G' };
+    constexpr std::uint32_t Binary_Log_Version = 1;
+    constexpr std::uint32_t Binary_Log_Byte_Order = 0x01020304;
+
+    enum class BinaryLogRecord : std::uint8_t {
+        Site = 1,
+        Event = 2,
+    };
+
+    std::uint32_t get_log_site_id(const penguin::log::LogSite& site); // assigns the site an ID the first time
+
+    // Replaces each "{}" in the format with the next argument ("{{" and "}}" are literal braces)
+    std::string render_log_format(std::string_view format, const unsigned char* args, std::size_t size);
+
+    class BinaryLogWriter {
+    public:
+        bool open(const char* path);
+        void close();
+        bool is_open() const { return file.is_open(); }
+
+        void write_event(const penguin::log::LogSite& site, std::uint64_t timestamp_ns, const unsigned char* args, std::size_t size);
+        void flush();
+
+    private:
+        void write_site(const penguin::log::LogSite& site, std::uint32_t id);
+        void put_string(std::string_view text);
+
+        template <typename T>
+        void put(T value) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        // Written to the file in blocks this large, but errors (which may precede a crash) and anything
+        // older than Flush_Interval are written out right away
+        static constexpr std::size_t Flush_Bytes = 64 * 1024;
+        static constexpr std::chrono::seconds Flush_Interval{ 1 };
+
+        std::ofstream file;
+        std::vector<unsigned char> buffer;
+        std::vector<bool> written_sites; // by site ID, for this file
+        std::chrono::steady_clock::time_point last_flush;
+    };
+
+    struct DecodedLogEvent {
+        std::uint64_t timestamp_ns = 0;
+        penguin::log::LogLevel level = penguin::log::LogLevel::Info;
+        std::string message;
+        std::string file;
+        int line = 0;
+        int column = 0;
+        std::string function;
+    };
+
+    class BinaryLogReader {
+    public:
+        bool open(const char* path);
+        bool next(DecodedLogEvent& event); // false at the end of the log, or if the rest of it is corrupt
+        bool is_truncated() const { return truncated; }
+
+    private:
+        struct Site {
+            penguin::log::LogLevel level;
+            int line;
+            int column;
+            std::string file;
+            std::string function;
+            std::string format;
+        };
+
+        bool read_bytes(void* out, std::size_t size);
+        bool read_string(std::string& out);
+
+        template <typename T>
+        bool read(T& value) { return read_bytes(&value, sizeof(T)); }
+
+        std::ifstream file;
+        std::unordered_map<std::uint32_t, Site> sites;
+        bool truncated = false;
+    };
+}
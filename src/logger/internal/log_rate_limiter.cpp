@@ -0,0 +1,109 @@
+#include <logger/internal/log_rate_limiter.hpp>
+
+#include <algorithm>
+
+namespace penguin::internal::log {
+
+    LogRateLimiter::Decision LogRateLimiter::check(penguin::log::LogRateBucket& bucket, Clock::time_point now) {
+        if (!enabled.load(std::memory_order_relaxed)) {
+            return {};
+        }
+
+        constexpr double Max_Window_Ns = 4e18; // about 125 years, keeps the full-again time within 64 bits with no rate
+
+        const double rate = per_second.load(std::memory_order_relaxed);
+        const double capacity = std::max(1.0f, burst.load(std::memory_order_relaxed));
+        const double interval_ns = report_interval.load(std::memory_order_relaxed) * 1e9;
+
+        // Every entry moves the full-again time one refill period later; an entry that would move it more than
+        // (burst - 1) periods past now has no token left
+        const double period_ns = std::min(rate > 0.0 ? 1e9 / rate : Max_Window_Ns, Max_Window_Ns / capacity);
+        const double tolerance_ns = (capacity - 1.0) * period_ns;
+        const std::int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+
+        std::int64_t full_at = bucket.full_at_ns.load(std::memory_order_relaxed);
+
+        while (true) {
+            const std::int64_t start = std::max(full_at, now_ns);
+
+            if (static_cast<double>(start - now_ns) > tolerance_ns) {
+                break; // out of tokens
+            }
+
+            if (bucket.full_at_ns.compare_exchange_weak(full_at, start + static_cast<std::int64_t>(period_ns), std::memory_order_relaxed)) {
+                bucket.last_report_ns.store(now_ns, std::memory_order_relaxed);
+
+                // Entries dropped since the last report go out with this one
+                const std::uint64_t suppressed = bucket.suppressed.load(std::memory_order_relaxed) ? bucket.suppressed.exchange(0, std::memory_order_relaxed) : 0;
+                return { true, suppressed };
+            }
+        }
+
+        bucket.suppressed.fetch_add(1, std::memory_order_relaxed);
+
+        // Still flooding: report what was dropped so far, but at most once per interval (by whichever thread claims it)
+        std::int64_t last_report = bucket.last_report_ns.load(std::memory_order_relaxed);
+
+        if (static_cast<double>(now_ns - last_report) >= interval_ns
+            && bucket.last_report_ns.compare_exchange_strong(last_report, now_ns, std::memory_order_relaxed)) {
+            return { false, bucket.suppressed.exchange(0, std::memory_order_relaxed) };
+        }
+
+        return { false, 0 };
+    }
+
+    LogRateLimiter::Decision LogRateLimiter::check(std::uint64_t site_key, Clock::time_point now) {
+        if (!enabled.load(std::memory_order_relaxed)) {
+            return {};
+        }
+
+        penguin::log::LogRateBucket* bucket = find_bucket(site_key);
+        return bucket ? check(*bucket, now) : Decision{};
+    }
+
+    penguin::log::LogRateBucket* LogRateLimiter::find_bucket(std::uint64_t site_key) {
+        if (site_key == 0) {
+            site_key = 1; // 0 marks a free slot
+        }
+
+        std::size_t index = static_cast<std::size_t>((site_key * 0x9e3779b97f4a7c15ull) >> 32) & (Table_Size - 1);
+
+        for (std::size_t probe = 0; probe < Max_Probes; ++probe, index = (index + 1) & (Table_Size - 1)) {
+            Slot& slot = slots[index];
+            std::uint64_t key = slot.key.load(std::memory_order_acquire);
+
+            if (key == 0 && slot.key.compare_exchange_strong(key, site_key, std::memory_order_acq_rel)) {
+                return &slot.bucket; // claimed a free slot
+            }
+
+            if (key == site_key) {
+                return &slot.bucket; // its own slot, or another thread claimed it for the same site first
+            }
+        }
+
+        return nullptr;
+    }
+
+    void LogRateLimiter::set_limit(const penguin::log::LogRateLimit& limit) {
+        per_second.store(std::max(0.0f, limit.per_second), std::memory_order_relaxed);
+        burst.store(limit.burst, std::memory_order_relaxed);
+        report_interval.store(std::max(0.0f, limit.report_interval), std::memory_order_relaxed);
+        enabled.store(limit.enabled, std::memory_order_relaxed);
+    }
+
+    penguin::log::LogRateLimit LogRateLimiter::get_limit() const {
+        return penguin::log::LogRateLimit{
+            enabled.load(std::memory_order_relaxed),
+            per_second.load(std::memory_order_relaxed),
+            burst.load(std::memory_order_relaxed),
+            report_interval.load(std::memory_order_relaxed)
+        };
+    }
+
+    std::uint64_t LogRateLimiter::get_site_key(const std::source_location& location) noexcept {
+        std::uint64_t key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(location.file_name()));
+        key ^= (static_cast<std::uint64_t>(location.line()) << 32 | location.column()) * 0x9e3779b97f4a7c15ull;
+
+        return key;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <penguin_framework/logger/log_rate_limit.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+
+namespace penguin::internal::log {
+
+    class LogRateLimiter {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Decision {
+            bool write = true; // whether the entry itself is written
+            std::uint64_t suppressed = 0; // entries to report before it (or instead of it), 0 for none
+        };
+
+        Decision check(penguin::log::LogRateBucket& bucket, Clock::time_point now = Clock::now());
+        Decision check(std::uint64_t site_key, Clock::time_point now = Clock::now()); // for calls without a LogSite
+
+        void set_limit(const penguin::log::LogRateLimit& limit);
+        penguin::log::LogRateLimit get_limit() const;
+
+        // Call sites are told apart by where they are, the file name pointer is unique per translation unit
+        static std::uint64_t get_site_key(const std::source_location& location) noexcept;
+
+    private:
+        // Calls without a LogSite find their bucket in a fixed open-addressed table, claimed with a compare-exchange on the key.
+        // A site that finds no free slot within Max_Probes is not limited.
+        struct Slot {
+            std::atomic<std::uint64_t> key{ 0 }; // 0 while free
+            penguin::log::LogRateBucket bucket;
+        };
+
+        static constexpr std::size_t Table_Size = 1024; // a power of two
+        static constexpr std::size_t Max_Probes = 16;
+
+        penguin::log::LogRateBucket* find_bucket(std::uint64_t site_key);
+
+        std::array<Slot, Table_Size> slots;
+        std::atomic<bool> enabled{ true };
+        std::atomic<float> per_second{ 10.0f };
+        std::atomic<float> burst{ 20.0f };
+        std::atomic<float> report_interval{ 1.0f };
+    };
+}
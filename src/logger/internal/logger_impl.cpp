@@ -4,11 +4,32 @@ namespace penguin::internal::log {
 
 	// Initalizing LogEntry struct
 
+    namespace {
+        // Reports of suppressed deferred-format entries, one site per level so the binary log keeps the level
+        const penguin::log::LogSite suppressed_sites[] = {
+            { "Suppressed {} entries from {}:{}", penguin::log::LogLevel::Debug, std::source_location::current() },
+            { "Suppressed {} entries from {}:{}", penguin::log::LogLevel::Info, std::source_location::current() },
+            { "Suppressed {} entries from {}:{}", penguin::log::LogLevel::Warning, std::source_location::current() },
+            { "Suppressed {} entries from {}:{}", penguin::log::LogLevel::Error, std::source_location::current() },
+        };
+
+        // The file name without its directories, without going through std::filesystem::path
+        std::string_view get_file_name(std::string_view path) {
+            const std::size_t separator = path.find_last_of("/\\");
+            return separator == std::string_view::npos ? path : path.substr(separator + 1);
+        }
+
+        // The limit is per call site and the dropped messages can differ, so the report names the site rather than a message
+        std::string get_suppressed_message(std::uint64_t count, const std::source_location& location) {
+            return "Suppressed " + std::to_string(count) + " entries from " + std::string(get_file_name(location.file_name())) + ":" + std::to_string(location.line());
+        }
+    }
+
     LogEntry::LogEntry(penguin::log::LogLevel p_level, std::string_view p_message, const std::source_location& p_location)
         : timestamp(std::chrono::system_clock::now()), 
         level(p_level), 
         message(p_message), 
-        file(std::filesystem::path(p_location.file_name()).filename().string()), 
+        file(get_file_name(p_location.file_name())), 
         line(p_location.line()),
         column(p_location.column()),
         function(p_location.function_name()) {}
@@ -37,10 +58,19 @@ namespace penguin::internal::log {
     }
 
     LoggerImpl::~LoggerImpl() {
+        if (writer.joinable()) {
+            async_enabled.store(false, std::memory_order_release);
+            stopping.store(true, std::memory_order_release);
+            wake_signal.fetch_add(1, std::memory_order_release);
+            wake_signal.notify_one();
+            writer.join(); // writes whatever is still queued first
+        }
+
         log_file.close();
+        binary_log.close();
     }
 
-    std::string LoggerImpl::log_level_to_string(penguin::log::LogLevel level) const {
+    std::string LoggerImpl::log_level_to_string(penguin::log::LogLevel level) {
         switch (level) {
             case penguin::log::LogLevel::Debug: 
                 return "DEBUG";
@@ -55,7 +85,7 @@ namespace penguin::internal::log {
         }
     }
 
-    std::string LoggerImpl::format_log_entry(const LogEntry& entry) const {
+    std::string LoggerImpl::format_log_entry(const LogEntry& entry) {
         auto time_t = std::chrono::system_clock::to_time_t(entry.timestamp);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             entry.timestamp.time_since_epoch()) % 1000;
@@ -76,7 +106,7 @@ namespace penguin::internal::log {
     }
 
     void LoggerImpl::write_log(const LogEntry& entry) {
-        if (entry.level < min_log_level) return;
+        if (entry.level < min_log_level.load(std::memory_order_relaxed)) return;
 
         std::string formatted = format_log_entry(entry);
 
@@ -90,4 +120,198 @@ namespace penguin::internal::log {
         log_file << formatted << std::endl;
         log_file.flush();
     }
-}
\ No newline at end of file
+
+    void LoggerImpl::submit(LogEntry&& entry) {
+        if (entry.level < min_log_level.load(std::memory_order_relaxed)) return;
+
+        if (async_enabled.load(std::memory_order_acquire)) {
+            enqueue(entry);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(log_mutex);
+        write_log(entry);
+    }
+
+    // Asynchronous mode
+
+    void LoggerImpl::set_async(bool enabled, const penguin::log::AsyncLogOptions& options) {
+        std::lock_guard<std::mutex> lock(async_mutex);
+
+        if (!enabled) {
+            async_enabled.store(false, std::memory_order_release);
+            flush(); // entries queued before the switch are written before any synchronous ones
+            return;
+        }
+
+        overflow_policy.store(options.overflow, std::memory_order_relaxed);
+
+        if (!queue) {
+            queue = std::make_unique<MpscRing<LogEntry>>(options.capacity);
+            writer = std::thread(&LoggerImpl::run_writer, this);
+        }
+
+        async_enabled.store(true, std::memory_order_release);
+    }
+
+    void LoggerImpl::flush() {
+        const std::uint64_t target = pushed.load(std::memory_order_acquire);
+
+        std::uint64_t done = written.load(std::memory_order_acquire);
+        while (done < target) {
+            written.wait(done, std::memory_order_acquire);
+            done = written.load(std::memory_order_acquire);
+        }
+
+        // The binary log keeps its events in a buffer until it fills
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        if (binary_log.is_open()) {
+            binary_log.flush();
+        }
+    }
+
+    void LoggerImpl::enqueue(LogEntry& entry) {
+        while (!queue->try_push(entry)) {
+            if (overflow_policy.load(std::memory_order_relaxed) != penguin::log::LogOverflowPolicy::Block) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            std::this_thread::yield(); // the writer is draining, try again
+        }
+
+        pushed.fetch_add(1, std::memory_order_release);
+        wake_signal.fetch_add(1, std::memory_order_release);
+        wake_signal.notify_one();
+    }
+
+    void LoggerImpl::run_writer() {
+        while (true) {
+            const std::uint32_t signal = wake_signal.load(std::memory_order_acquire);
+
+            while (write_batch() > 0) {}
+
+            // Count policy: the drops are logged once there is room again
+            const std::uint64_t dropped_now = dropped.load(std::memory_order_relaxed);
+            if (dropped_now != reported_dropped) {
+                if (overflow_policy.load(std::memory_order_relaxed) == penguin::log::LogOverflowPolicy::Count) {
+                    LogEntry report;
+                    report.level = penguin::log::LogLevel::Warning;
+                    report.message = std::to_string(dropped_now - reported_dropped) + " log entries were dropped, the asynchronous log queue was full.";
+
+                    std::lock_guard<std::mutex> lock(log_mutex);
+                    write_log(report);
+                }
+
+                reported_dropped = dropped_now;
+            }
+
+            if (stopping.load(std::memory_order_acquire)) {
+                if (write_batch() == 0) {
+                    return;
+                }
+
+                continue; // a last producer got in before the stop
+            }
+
+            wake_signal.wait(signal, std::memory_order_acquire); // returns right away if anything was pushed since
+        }
+    }
+
+    std::size_t LoggerImpl::write_batch() {
+        std::string out;
+        std::string err;
+        std::string file;
+        std::size_t count = 0;
+
+        for (; count < Batch_Size; ++count) {
+            std::optional<LogEntry> entry = queue->try_pop();
+            if (!entry) {
+                break;
+            }
+
+            std::string formatted = format_log_entry(*entry);
+            formatted += '\n';
+
+            if (entry->level == penguin::log::LogLevel::Warning || entry->level == penguin::log::LogLevel::Error) {
+                err += formatted;
+            }
+            else {
+                out += formatted;
+            }
+
+            file += formatted;
+        }
+
+        if (count == 0) {
+            return 0;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(log_mutex);
+
+            if (!out.empty()) {
+                std::cout.write(out.data(), static_cast<std::streamsize>(out.size())).flush();
+            }
+            if (!err.empty()) {
+                std::cerr.write(err.data(), static_cast<std::streamsize>(err.size()));
+            }
+
+            log_file.write(file.data(), static_cast<std::streamsize>(file.size()));
+            log_file.flush(); // once per batch instead of once per entry
+        }
+
+        written.fetch_add(count, std::memory_order_release);
+        written.notify_all();
+
+        return count;
+    }
+
+    // Binary log
+
+    bool LoggerImpl::write_binary(const penguin::log::LogSite& site, const unsigned char* args, std::size_t size) {
+        if (!binary_enabled.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        const std::uint64_t timestamp_ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        if (!binary_log.is_open()) {
+            return false; // closed in the meantime
+        }
+
+        binary_log.write_event(site, timestamp_ns, args, size);
+        return true;
+    }
+
+    // Rate limiting
+
+    bool LoggerImpl::pass_rate_limit(penguin::log::LogLevel level, const std::source_location& location) {
+        const LogRateLimiter::Decision decision = rate_limiter.check(LogRateLimiter::get_site_key(location));
+
+        if (decision.suppressed > 0) {
+            submit(LogEntry(level, get_suppressed_message(decision.suppressed, location), location));
+        }
+
+        return decision.write;
+    }
+
+    bool LoggerImpl::pass_rate_limit(const penguin::log::LogSite& site) {
+        const LogRateLimiter::Decision decision = rate_limiter.check(site.rate);
+
+        if (decision.suppressed > 0) {
+            penguin::log::LogArgs report;
+            report.add(decision.suppressed);
+            report.add(get_file_name(site.location.file_name()));
+            report.add(site.location.line());
+
+            if (!write_binary(suppressed_sites[static_cast<int>(site.level)], report.get_data(), report.get_size())) {
+                submit(LogEntry(site.level, get_suppressed_message(decision.suppressed, site.location), site.location));
+            }
+        }
+
+        return decision.write;
+    }
+}
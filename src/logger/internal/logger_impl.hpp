@@ -1,6 +1,10 @@
 #pragma once
 
 #include <penguin_framework/logger/log_level.hpp>
+#include <penguin_framework/logger/async_log_options.hpp>
+#include <logger/internal/mpsc_ring.hpp>
+#include <logger/internal/binary_log.hpp>
+#include <logger/internal/log_rate_limiter.hpp>
 
 #include <source_location>
 #include <string>
@@ -11,6 +15,9 @@
 #include <mutex>
 #include <memory>
 #include <filesystem>
+#include <atomic>
+#include <cstdint>
+#include <thread>
 
 namespace penguin::internal::log {
 
@@ -32,18 +39,58 @@ namespace penguin::internal::log {
         LoggerImpl();
         ~LoggerImpl();
 
-        std::string log_level_to_string(penguin::log::LogLevel level) const;
-        std::string format_log_entry(const LogEntry& entry) const;
+        static std::string log_level_to_string(penguin::log::LogLevel level);
+        static std::string format_log_entry(const LogEntry& entry);
         void write_log(const LogEntry& entry);
+        void submit(LogEntry&& entry); // queued in asynchronous mode, otherwise written right away
+
+        // Asynchronous mode: producers push into the ring without locking, the writer thread drains it in batches
+
+        void set_async(bool enabled, const penguin::log::AsyncLogOptions& options);
+        void flush(); // waits until every entry queued so far is written, then writes out the binary log
+
+        // Rate limiting: false when the entry is suppressed. A report of the entries dropped before it is written first.
+
+        bool pass_rate_limit(penguin::log::LogLevel level, const std::source_location& location);
+        bool pass_rate_limit(const penguin::log::LogSite& site); // uses the site's own bucket
+
+        LogRateLimiter rate_limiter;
+
+        // Binary log
+
+        bool write_binary(const penguin::log::LogSite& site, const unsigned char* args, std::size_t size); // false when no binary log is open
+
+        std::mutex binary_mutex;
+        BinaryLogWriter binary_log;
+        std::atomic<bool> binary_enabled{ false };
 
         mutable std::mutex log_mutex;
+        std::mutex async_mutex; // serializes set_async()
+
+        std::unique_ptr<MpscRing<LogEntry>> queue; // created on first use and kept, so a late producer never sees it freed
+        std::thread writer;
+        std::atomic<bool> async_enabled{ false };
+        std::atomic<bool> stopping{ false };
+        std::atomic<penguin::log::LogOverflowPolicy> overflow_policy{ penguin::log::LogOverflowPolicy::Count };
+        std::atomic<std::uint32_t> wake_signal{ 0 }; // bumped after every push, the writer sleeps on it
+        std::atomic<std::uint64_t> pushed{ 0 };
+        std::atomic<std::uint64_t> written{ 0 };
+        std::atomic<std::uint64_t> dropped{ 0 };
+        std::uint64_t reported_dropped = 0; // writer thread only
 
         std::ofstream log_file;
         std::filesystem::path log_path;
 
         LogEntry last_error;
         bool has_error;
-        penguin::log::LogLevel min_log_level;
+        std::atomic<penguin::log::LogLevel> min_log_level; // checked before an entry is built, so filtered calls cost one load
+
+    private:
+        void enqueue(LogEntry& entry);
+        void run_writer();
+        std::size_t write_batch(); // pops up to Batch_Size entries and writes them with one call per stream
+
+        static constexpr std::size_t Batch_Size = 256;
 	};
 }
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+
+namespace penguin::internal::log {
+
+    // Bounded multi-producer, single-consumer queue, lock-free on both sides.
+    // Each slot carries a sequence number: a producer claims a position with a CAS on the tail, and the slot's sequence
+    // tells the producer the slot is free (sequence == position) and the consumer that it is filled (sequence == position + 1).
+    template <typename T>
+    class MpscRing {
+    public:
+        explicit MpscRing(std::size_t min_capacity) : capacity(round_up_to_power_of_two(min_capacity)), mask(capacity - 1), slots(std::make_unique<Slot[]>(capacity)) {
+            for (std::size_t i = 0; i < capacity; ++i) {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~MpscRing() {
+            while (try_pop()) {} // destroys the values still queued
+        }
+
+        // Copy & move (including assigment) not allowed
+
+        MpscRing(const MpscRing&) = delete;
+        MpscRing& operator=(const MpscRing&) = delete;
+        MpscRing(MpscRing&&) noexcept = delete;
+        MpscRing& operator=(MpscRing&&) noexcept = delete;
+
+        // Any thread. Returns false (leaving value untouched) when the ring is full.
+        bool try_push(T& value) {
+            std::size_t position = tail.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot = slots[position & mask];
+                const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if (difference == 0) {
+                    if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        new (&slot.storage) T(std::move(value));
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0) {
+                    return false; // the consumer has not freed this slot yet
+                }
+                else {
+                    position = tail.load(std::memory_order_relaxed); // another producer took it
+                }
+            }
+        }
+
+        // The consumer thread only
+        std::optional<T> try_pop() {
+            Slot& slot = slots[head & mask];
+
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+                return std::nullopt; // empty, or the producer that claimed the slot is still writing it
+            }
+
+            T* stored = std::launder(reinterpret_cast<T*>(&slot.storage));
+            std::optional<T> value(std::move(*stored));
+            stored->~T();
+
+            slot.sequence.store(head + capacity, std::memory_order_release); // free for the producers' next lap
+            ++head;
+
+            return value;
+        }
+
+        std::size_t get_capacity() const noexcept { return capacity; }
+
+    private:
+        struct Slot {
+            std::atomic<std::size_t> sequence{ 0 };
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        static std::size_t round_up_to_power_of_two(std::size_t value) {
+            std::size_t result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+
+            return result;
+        }
+
+        const std::size_t capacity;
+        const std::size_t mask;
+        std::unique_ptr<Slot[]> slots;
+
+        alignas(64) std::atomic<std::size_t> tail{ 0 }; // producers, kept off the consumer's cache line
+        alignas(64) std::size_t head = 0;
+    };
+}
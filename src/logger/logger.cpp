@@ -2,9 +2,6 @@
 #include <logger/internal/logger_impl.hpp>
 
 namespace penguin::log {
-    static std::unique_ptr<Logger> instance;
-    static std::mutex instance_mutex;
-
     Logger::Logger() : pimpl_(std::make_unique<penguin::internal::log::LoggerImpl>()) {}
 
     Logger::~Logger() = default;
@@ -13,35 +10,133 @@ namespace penguin::log {
     Logger& Logger::operator=(Logger&&) noexcept = default;
 
     Logger& Logger::get_instance() {
-        std::lock_guard<std::mutex> lock(instance_mutex);
-        if (!instance) {
-            instance = std::unique_ptr<Logger>(new Logger());
-        }
-        return *instance;
+        static Logger instance; // initialized once (thread-safe), no lock on every logging call
+        return instance;
+    }
+
+    // Level filtering
+
+    void Logger::set_min_level(LogLevel level) {
+        pimpl_->min_log_level.store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel Logger::get_min_level() const {
+        return pimpl_->min_log_level.load(std::memory_order_relaxed);
+    }
+
+    bool Logger::is_enabled(LogLevel level) const noexcept {
+        return pimpl_ && level >= pimpl_->min_log_level.load(std::memory_order_relaxed);
     }
 
     void Logger::debug(const char* message, const std::source_location& p_location) {
-        std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
-        pimpl_->write_log(penguin::internal::log::LogEntry(LogLevel::Debug, message, p_location));
+        if (!is_enabled(LogLevel::Debug)) return; // before the entry copies the message and location
+        if (!pimpl_->pass_rate_limit(LogLevel::Debug, p_location)) return;
+
+        pimpl_->submit(penguin::internal::log::LogEntry(LogLevel::Debug, message, p_location));
     }
 
     void Logger::info(const char* message, const std::source_location& p_location) {
-        std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
-        pimpl_->write_log(penguin::internal::log::LogEntry(LogLevel::Info, message, p_location));
+        if (!is_enabled(LogLevel::Info)) return; // before the entry copies the message and location
+        if (!pimpl_->pass_rate_limit(LogLevel::Info, p_location)) return;
+
+        pimpl_->submit(penguin::internal::log::LogEntry(LogLevel::Info, message, p_location));
     }
 
     void Logger::warning(const char* message, const std::source_location& p_location) {
-        std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
-        pimpl_->write_log(penguin::internal::log::LogEntry(LogLevel::Warning, message, p_location));
+        if (!is_enabled(LogLevel::Warning)) return; // before the entry copies the message and location
+        if (!pimpl_->pass_rate_limit(LogLevel::Warning, p_location)) return;
+
+        pimpl_->submit(penguin::internal::log::LogEntry(LogLevel::Warning, message, p_location));
     }
 
     void Logger::error(const char* message, const std::source_location& p_location) {
-        std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
+        if (!is_enabled(LogLevel::Error)) return;
+
         penguin::internal::log::LogEntry error_entry(LogLevel::Error, message, p_location);
-        pimpl_->write_log(error_entry);
 
-        pimpl_->last_error = error_entry;
-        pimpl_->has_error = true;
+        {
+            // Kept even when the entry is rate limited, so get_last_error_message() always sees the newest error
+            std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
+            pimpl_->last_error = error_entry;
+            pimpl_->has_error = true;
+        }
+
+        if (!pimpl_->pass_rate_limit(LogLevel::Error, p_location)) return;
+
+        pimpl_->submit(std::move(error_entry));
+    }
+
+    void Logger::log_deferred(const LogSite& site, const unsigned char* args, std::size_t size) {
+        if (!is_enabled(site.level)) return;
+
+        if (site.level == LogLevel::Error) {
+            // Errors are rare, and formatted right away to be kept as the last error (even when rate limited)
+            penguin::internal::log::LogEntry error_entry(LogLevel::Error, penguin::internal::log::render_log_format(site.format, args, size), site.location);
+
+            {
+                std::lock_guard<std::mutex> lock(pimpl_->log_mutex);
+                pimpl_->last_error = error_entry;
+                pimpl_->has_error = true;
+            }
+
+            if (!pimpl_->pass_rate_limit(site)) return;
+
+            if (!pimpl_->write_binary(site, args, size)) {
+                pimpl_->submit(std::move(error_entry));
+            }
+
+            return;
+        }
+
+        if (!pimpl_->pass_rate_limit(site)) return;
+
+        if (!pimpl_->write_binary(site, args, size)) {
+            pimpl_->submit(penguin::internal::log::LogEntry(site.level, penguin::internal::log::render_log_format(site.format, args, size), site.location));
+        }
+    }
+
+    // Rate limiting
+
+    void Logger::set_rate_limit(const LogRateLimit& limit) {
+        pimpl_->rate_limiter.set_limit(limit);
+    }
+
+    LogRateLimit Logger::get_rate_limit() const {
+        return pimpl_->rate_limiter.get_limit();
+    }
+
+    bool Logger::open_binary_log(const char* path) {
+        if (!path) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(pimpl_->binary_mutex);
+        const bool opened = pimpl_->binary_log.open(path);
+        pimpl_->binary_enabled.store(opened, std::memory_order_release);
+
+        return opened;
+    }
+
+    void Logger::close_binary_log() {
+        std::lock_guard<std::mutex> lock(pimpl_->binary_mutex);
+        pimpl_->binary_enabled.store(false, std::memory_order_release);
+        pimpl_->binary_log.close();
+    }
+
+    void Logger::set_async(bool enabled, const AsyncLogOptions& options) {
+        pimpl_->set_async(enabled, options);
+    }
+
+    bool Logger::is_async() const {
+        return pimpl_->async_enabled.load(std::memory_order_acquire);
+    }
+
+    void Logger::flush() {
+        pimpl_->flush();
+    }
+
+    std::uint64_t Logger::get_dropped_count() const {
+        return pimpl_->dropped.load(std::memory_order_relaxed);
     }
    
     bool Logger::has_error() const {
@@ -0,0 +1,164 @@
+#include <rendering/drawables/internal/number_renderer_impl.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+namespace penguin::internal::rendering::drawables {
+
+	NumberRendererImpl::NumberRendererImpl(NativeRendererPtr renderer_ptr, NativeFontPtr font_ptr, penguin::math::Colour p_colour, penguin::math::Vector2 p_position)
+		: atlas(nullptr, &SDL_DestroyTexture), glyphs{}, line_height(0.0f), buffer{}, length(0), vertices{}, indices{}, quad_count(0), width(0.0f),
+		position(p_position), colour(p_colour) {
+
+		penguin::internal::error::InternalError::throw_if(
+			!renderer_ptr.ptr || !font_ptr.ptr,
+			"The renderer and/or the font are either null or have not been initialized.",
+			penguin::internal::error::ErrorCode::Null_Argument
+		);
+
+		bake_atlas(renderer_ptr.as<SDL_Renderer>(), font_ptr.as<TTF_Font>());
+
+		penguin::internal::error::InternalError::throw_if(
+			!atlas,
+			"Failed to create the number renderer atlas.",
+			penguin::internal::error::ErrorCode::Number_Renderer_Creation_Failed
+		);
+
+		set_int(0);
+	}
+
+	// Formatting functions
+
+	void NumberRendererImpl::set_int(std::int64_t value) {
+		auto [end, ec] = std::to_chars(buffer.data(), buffer.data() + Max_Chars, value);
+		length = (ec == std::errc{}) ? static_cast<std::size_t>(end - buffer.data()) : 0;
+		buffer[length] = '\0';
+
+		update_geometry();
+	}
+
+	void NumberRendererImpl::set_float(double value, int precision) {
+		precision = std::clamp(precision, 0, 16);
+
+		std::to_chars_result res = std::to_chars(buffer.data(), buffer.data() + Max_Chars, value, std::chars_format::fixed, precision);
+		if (res.ec != std::errc{}) { // too large to print in fixed notation, fall back to scientific
+			res = std::to_chars(buffer.data(), buffer.data() + Max_Chars, value, std::chars_format::scientific, precision);
+		}
+
+		length = (res.ec == std::errc{}) ? static_cast<std::size_t>(res.ptr - buffer.data()) : 0;
+		buffer[length] = '\0';
+
+		update_geometry();
+	}
+
+	void NumberRendererImpl::update_geometry() {
+		SDL_FColor vertex_colour{ colour.r, colour.g, colour.b, colour.a };
+		float atlas_w = static_cast<float>(atlas->w);
+		float atlas_h = static_cast<float>(atlas->h);
+		float pen_x = position.x;
+
+		quad_count = 0;
+
+		for (std::size_t i = 0; i < length; ++i) {
+			unsigned char c = static_cast<unsigned char>(buffer[i]);
+			if (c >= glyphs.size()) {
+				continue; // not in the atlas
+			}
+
+			const NumberGlyph& glyph = glyphs[c];
+
+			if (glyph.region.w > 0.0f) {
+				float x0 = pen_x;
+				float y0 = position.y;
+				float x1 = x0 + glyph.region.w;
+				float y1 = y0 + glyph.region.h;
+
+				float u0 = glyph.region.x / atlas_w;
+				float v0 = glyph.region.y / atlas_h;
+				float u1 = (glyph.region.x + glyph.region.w) / atlas_w;
+				float v1 = (glyph.region.y + glyph.region.h) / atlas_h;
+
+				int base = quad_count * 4;
+				vertices[base + 0] = SDL_Vertex{ { x0, y0 }, vertex_colour, { u0, v0 } };
+				vertices[base + 1] = SDL_Vertex{ { x1, y0 }, vertex_colour, { u1, v0 } };
+				vertices[base + 2] = SDL_Vertex{ { x1, y1 }, vertex_colour, { u1, v1 } };
+				vertices[base + 3] = SDL_Vertex{ { x0, y1 }, vertex_colour, { u0, v1 } };
+
+				int* quad_indices = indices.data() + quad_count * 6;
+				quad_indices[0] = base + 0;
+				quad_indices[1] = base + 1;
+				quad_indices[2] = base + 2;
+				quad_indices[3] = base + 0;
+				quad_indices[4] = base + 2;
+				quad_indices[5] = base + 3;
+
+				++quad_count;
+			}
+
+			pen_x += glyph.advance;
+		}
+
+		width = pen_x - position.x;
+	}
+
+	void NumberRendererImpl::bake_atlas(SDL_Renderer* renderer, TTF_Font* font) {
+		constexpr SDL_Color white{ 255, 255, 255, 255 }; // tinted per vertex when drawn
+		constexpr int padding = 1; // keeps linear filtering from bleeding into neighbouring glyphs
+
+		std::array<SDL_Surface*, Charset.size()> rendered{};
+		int atlas_w = padding;
+		int atlas_h = TTF_GetFontHeight(font);
+
+		line_height = static_cast<float>(atlas_h);
+
+		// Rasterise every glyph once
+		for (std::size_t i = 0; i < Charset.size(); ++i) {
+			Uint32 c = static_cast<unsigned char>(Charset[i]);
+			int min_x, max_x, min_y, max_y, advance = 0;
+
+			if (!TTF_FontHasGlyph(font, c) || !TTF_GetGlyphMetrics(font, c, &min_x, &max_x, &min_y, &max_y, &advance)) {
+				continue;
+			}
+
+			glyphs[c].advance = static_cast<float>(advance);
+
+			if (c != ' ') { // whitespace only needs its advance
+				rendered[i] = TTF_RenderGlyph_Blended(font, c, white);
+			}
+
+			if (rendered[i]) {
+				atlas_w += rendered[i]->w + padding;
+				atlas_h = std::max(atlas_h, rendered[i]->h);
+			}
+		}
+
+		// Pack the glyphs into a single row
+		SDL_Surface* atlas_surface = SDL_CreateSurface(atlas_w, atlas_h, SDL_PIXELFORMAT_RGBA32);
+
+		if (atlas_surface) {
+			int pen_x = padding;
+
+			for (std::size_t i = 0; i < Charset.size(); ++i) {
+				if (!rendered[i]) {
+					continue;
+				}
+
+				Uint32 c = static_cast<unsigned char>(Charset[i]);
+				SDL_Rect dest{ pen_x, 0, rendered[i]->w, rendered[i]->h };
+
+				SDL_SetSurfaceBlendMode(rendered[i], SDL_BLENDMODE_NONE); // copy the alpha channel as-is
+				if (SDL_BlitSurface(rendered[i], nullptr, atlas_surface, &dest)) {
+					glyphs[c].region = SDL_FRect{ static_cast<float>(dest.x), static_cast<float>(dest.y), static_cast<float>(dest.w), static_cast<float>(dest.h) };
+				}
+
+				pen_x += rendered[i]->w + padding;
+			}
+
+			atlas.reset(SDL_CreateTextureFromSurface(renderer, atlas_surface));
+			SDL_DestroySurface(atlas_surface);
+		}
+
+		for (SDL_Surface* surface : rendered) {
+			SDL_DestroySurface(surface); // safe to call with nullptr
+		}
+	}
+}
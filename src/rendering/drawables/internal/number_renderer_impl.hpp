@@ -0,0 +1,65 @@
+#pragma once
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/math/colours.hpp>
+#include <penguin_framework/math/vector2.hpp>
+
+#include <error/internal/internal_error.hpp>
+
+#include <SDL3/SDL_render.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include <memory>
+#include <array>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace penguin::internal::rendering::drawables {
+
+	struct NumberGlyph {
+		SDL_FRect region{ 0.0f, 0.0f, 0.0f, 0.0f }; // location in the atlas
+		float advance = 0.0f; // zero for characters that aren't in the atlas
+	};
+
+	class NumberRendererImpl {
+	public:
+		static constexpr std::string_view Charset = "0123456789+-.,:/%xXe ";
+		static constexpr std::size_t Max_Chars = 32;
+
+		std::unique_ptr<SDL_Texture, void(*)(SDL_Texture*)> atlas;
+		std::array<NumberGlyph, 128> glyphs; // indexed by ASCII code
+		float line_height;
+
+		std::array<char, Max_Chars + 1> buffer; // null-terminated formatted value
+		std::size_t length;
+
+		std::array<SDL_Vertex, Max_Chars * 4> vertices;
+		std::array<int, Max_Chars * 6> indices;
+		int quad_count;
+		float width;
+
+		penguin::math::Vector2 position;
+		penguin::math::Colour colour;
+
+		// Constructor
+
+		NumberRendererImpl(NativeRendererPtr renderer_ptr, NativeFontPtr font_ptr, penguin::math::Colour p_colour, penguin::math::Vector2 p_position);
+
+		NumberRendererImpl(const NumberRendererImpl&) = delete;
+		NumberRendererImpl& operator=(const NumberRendererImpl&) = delete;
+		NumberRendererImpl(NumberRendererImpl&&) noexcept = default;
+		NumberRendererImpl& operator=(NumberRendererImpl&&) noexcept = default;
+
+		// Formatting functions (no heap allocation)
+
+		void set_int(std::int64_t value);
+		void set_float(double value, int precision);
+
+		// Rebuilds the vertex and index batch from the formatted buffer
+		void update_geometry();
+
+	private:
+		void bake_atlas(SDL_Renderer* renderer, TTF_Font* font);
+	};
+}
@@ -1,12 +1,15 @@
 #include <rendering/drawables/internal/text_impl.hpp>
 
+#include <algorithm>
+
 namespace penguin::internal::rendering::drawables {
 
-    TextImpl::TextImpl(NativeTextContextPtr text_renderer_ptr, NativeFontPtr font,
+    TextImpl::TextImpl(systems::TextLayoutCache& p_layout_cache, std::shared_ptr<penguin::rendering::primitives::Font> p_font,
         const char* p_str, penguin::math::Colour p_colour, penguin::math::Vector2 p_position)
-    : text(TTF_CreateText(text_renderer_ptr.as<TTF_TextEngine>(), font.as<TTF_Font>(), p_str, 0), &TTF_DestroyText) {
+    : layout(p_layout_cache.acquire(p_font->get_native_ptr().as<TTF_Font>(), p_str)), layout_cache(&p_layout_cache), font(std::move(p_font)),
+        baked(nullptr, &SDL_DestroyTexture), baked_renderer(nullptr), lines_font(nullptr), lines_font_generation(0), lines_dirty(true) {
         penguin::internal::error::InternalError::throw_if(
-            !text,
+            !layout,
             "Failed to create the text.",
             penguin::internal::error::ErrorCode::Text_Creation_Failed
         );
@@ -14,6 +17,139 @@ namespace penguin::internal::rendering::drawables {
         str = p_str; 
         colour = p_colour;
         position = p_position;
+        scale = 1.0f;
+    }
+
+    bool TextImpl::set_string(const char* new_str) {
+        std::shared_ptr<systems::TextLayout> new_layout = layout_cache->acquire(font->get_native_ptr().as<TTF_Font>(), new_str);
+
+        if (!new_layout) {
+            return false; // keep displaying the previous string
+        }
+
+        layout = std::move(new_layout);
+        str = new_str;
+        invalidate_lines();
+
+        if (baked) {
+            return bake(baked_renderer); // keep static text in sync with its string
+        }
+
+        return true;
+    }
+
+    bool TextImpl::bake(SDL_Renderer* renderer) {
+        constexpr SDL_Color white{ 255, 255, 255, 255 }; // the colour is applied as a texture modulation, so it can change without re-baking
+
+        if (!update_lines()) {
+            return false;
+        }
+
+        SDL_Surface* surface = SDL_CreateSurface(std::max(lines_size.x, 1), std::max(lines_size.y, 1), SDL_PIXELFORMAT_RGBA32);
+        if (!surface) {
+            return false;
+        }
+
+        SDL_FillSurfaceRect(surface, nullptr, 0); // transparent background
+
+        // Rasterise line by line, so the baked text has the same wrapping, alignment and spacing as the live text
+        TTF_Font* ttf_font = font->get_native_ptr().as<TTF_Font>();
+        bool res = true;
+
+        for (const penguin::rendering::primitives::LineMetrics& line : lines) {
+            if (line.length == 0) {
+                continue;
+            }
+
+            SDL_Surface* line_surface = TTF_RenderText_Blended(ttf_font, str.data() + line.offset, line.length, white);
+            if (!line_surface) {
+                res = false;
+                break;
+            }
+
+            SDL_Rect dst{ static_cast<int>(line.bounds.position.x), static_cast<int>(line.bounds.position.y), line_surface->w, line_surface->h };
+            SDL_SetSurfaceBlendMode(line_surface, SDL_BLENDMODE_NONE); // copy the coverage as is instead of blending onto the empty surface
+            res = SDL_BlitSurface(line_surface, nullptr, surface, &dst);
+            SDL_DestroySurface(line_surface);
+
+            if (!res) {
+                break;
+            }
+        }
+
+        SDL_Texture* texture = res ? SDL_CreateTextureFromSurface(renderer, surface) : nullptr;
+        SDL_DestroySurface(surface);
+
+        if (!texture) {
+            return false;
+        }
+
+        baked.reset(texture);
+        baked_renderer = renderer;
+
+        return apply_baked_colour();
+    }
+
+    void TextImpl::unbake() {
+        baked.reset();
+        baked_renderer = nullptr;
+    }
+
+    bool TextImpl::apply_baked_colour() {
+        return SDL_SetTextureColorModFloat(baked.get(), colour.r, colour.g, colour.b) && SDL_SetTextureAlphaModFloat(baked.get(), colour.a);
+    }
+
+    // Paragraph layout
+
+    bool TextImpl::uses_paragraph_layout() const {
+        return layout_options.wrap_width > 0
+            || layout_options.alignment != penguin::rendering::primitives::TextAlignment::Left
+            || layout_options.line_spacing != 1.0f;
+    }
+
+    bool TextImpl::update_lines() {
+        TTF_Font* ttf_font = font->get_native_ptr().as<TTF_Font>();
+        Uint32 generation = TTF_GetFontGeneration(ttf_font); // changes with the font's size, style and outline
+
+        if (!lines_dirty && ttf_font == lines_font && generation == lines_font_generation) {
+            return true; // the cached line breaks are still valid
+        }
+
+        if (!primitives::break_lines(ttf_font, str, layout_options, lines, lines_size)) {
+            return false;
+        }
+
+        // Shape each line through the shared cache, so repeated lines (and other Text objects) reuse the same TTF_Text
+        line_layouts.clear();
+
+        if (uses_paragraph_layout()) {
+            line_layouts.reserve(lines.size());
+
+            for (const penguin::rendering::primitives::LineMetrics& line : lines) {
+                if (line.length == 0) {
+                    line_layouts.push_back(nullptr); // nothing to draw
+                    continue;
+                }
+
+                std::shared_ptr<systems::TextLayout> line_layout = layout_cache->acquire(ttf_font, std::string_view(str).substr(line.offset, line.length));
+                if (!line_layout) {
+                    line_layouts.clear();
+                    return false;
+                }
+
+                line_layouts.push_back(std::move(line_layout));
+            }
+        }
+
+        lines_font = ttf_font;
+        lines_font_generation = generation;
+        lines_dirty = false;
+
+        return true;
+    }
+
+    void TextImpl::invalidate_lines() {
+        lines_dirty = true;
     }
 
 }
\ No newline at end of file
@@ -1,25 +1,59 @@
 #pragma once
 
 #include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/text_metrics.hpp>
 #include <penguin_framework/math/colours.hpp>
 #include <penguin_framework/math/vector2.hpp>
+#include <penguin_framework/math/vector2i.hpp>
 
+#include <rendering/systems/internal/text_layout_cache.hpp>
+#include <rendering/primitives/internal/line_breaker.hpp>
 #include <error/internal/internal_error.hpp>
 
+#include <SDL3/SDL_render.h>
 #include <SDL3_ttf/SDL_ttf.h>
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace penguin::internal::rendering::drawables {
 
     struct TextImpl {
-        std::unique_ptr<TTF_Text, void(*)(TTF_Text*)> text;
+        std::shared_ptr<systems::TextLayout> layout; // shared with every Text displaying the same string
+        systems::TextLayoutCache* layout_cache; // owned by the TextContext
+        std::shared_ptr<penguin::rendering::primitives::Font> font;
         std::string str;
         penguin::math::Vector2 position;
         penguin::math::Colour colour;
+        float scale;
+        std::unique_ptr<SDL_Texture, void(*)(SDL_Texture*)> baked; // rasterised once for static text, drawn as a single quad
+        SDL_Renderer* baked_renderer;
 
-        TextImpl(NativeTextContextPtr text_renderer_ptr, NativeFontPtr font, const char* str, penguin::math::Colour colour = Colours::White, penguin::math::Vector2 position = penguin::math::Vector2::Zero);
+        // Paragraph layout, recomputed only when the string, font or layout options change
+        primitives::LineBreakOptions layout_options;
+        std::vector<penguin::rendering::primitives::LineMetrics> lines;
+        std::vector<std::shared_ptr<systems::TextLayout>> line_layouts; // one shaped line each, only used by paragraph layout
+        penguin::math::Vector2i lines_size;
+        TTF_Font* lines_font;
+        Uint32 lines_font_generation;
+        bool lines_dirty;
 
+        TextImpl(systems::TextLayoutCache& p_layout_cache, std::shared_ptr<penguin::rendering::primitives::Font> p_font, const char* str, penguin::math::Colour colour = Colours::White, penguin::math::Vector2 position = penguin::math::Vector2::Zero);
+
+        bool set_string(const char* new_str);
+
+        // Paragraph layout
+
+        bool uses_paragraph_layout() const; // plain text is drawn as a single TTF_Text
+        bool update_lines();
+        void invalidate_lines();
+
+        // Static text baking
+
+        bool bake(SDL_Renderer* renderer);
+        void unbake();
+        bool apply_baked_colour();
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,146 @@
+#include <penguin_framework/rendering/drawables/number_renderer.hpp>
+#include <rendering/drawables/internal/number_renderer_impl.hpp>
+#include <penguin_framework/logger/logger.hpp>
+
+namespace penguin::rendering::drawables {
+
+	NumberRenderer::NumberRenderer(NativeRendererPtr renderer_ptr, std::shared_ptr<penguin::rendering::primitives::Font> font,
+		penguin::math::Colour colour, penguin::math::Vector2 position) : pimpl_(nullptr) {
+
+		// Log attempt to create a number renderer
+		PF_LOG_INFO("Attempting to create number renderer...");
+
+		if (renderer_ptr.ptr && font && font->is_valid()) { // If the renderer / font is invalid, don't bother trying to bake the atlas
+			try {
+				pimpl_ = std::make_unique<penguin::internal::rendering::drawables::NumberRendererImpl>(renderer_ptr, font->get_native_ptr(), colour, position);
+				PF_LOG_INFO("Success: NumberRenderer created successfully.");
+			}
+			catch (const penguin::internal::error::InternalError& e) {
+				// Get the error code and message
+				std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+				std::string error_message = error_code_str + ": " + e.what();
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+
+			}
+			catch (const std::exception& e) { // Other specific C++ errors
+				// Get error message
+				std::string last_error_message = e.what();
+				std::string error_message = "Unknown_Error: " + last_error_message;
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+			}
+		}
+		else {
+			PF_LOG_ERROR("Number_Renderer_Creation_Failed: The renderer and/or the font are either null or have not been initialized.");
+		}
+	}
+
+	NumberRenderer::~NumberRenderer() = default;
+
+	NumberRenderer::NumberRenderer(NumberRenderer&&) noexcept = default;
+	NumberRenderer& NumberRenderer::operator=(NumberRenderer&&) noexcept = default;
+
+	// Validity checking
+
+	bool NumberRenderer::is_valid() const noexcept {
+		if (!pimpl_) {
+			return false;
+		}
+
+		return pimpl_->atlas.get();
+	}
+
+	NumberRenderer::operator bool() const noexcept {
+		return is_valid();
+	}
+
+	// Getters
+
+	penguin::math::Vector2 NumberRenderer::get_position() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_position() called on an uninitialized or destroyed number renderer.");
+			return penguin::math::Vector2::Zero;
+		}
+
+		return pimpl_->position;
+	}
+
+	penguin::math::Colour NumberRenderer::get_colour() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_colour() called on an uninitialized or destroyed number renderer.");
+			return Colours::NoTint;
+		}
+
+		return pimpl_->colour;
+	}
+
+	penguin::math::Vector2 NumberRenderer::get_size() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_size() called on an uninitialized or destroyed number renderer.");
+			return penguin::math::Vector2::Zero;
+		}
+
+		return penguin::math::Vector2{ pimpl_->width, pimpl_->line_height };
+	}
+
+	const char* NumberRenderer::get_string() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_string() called on an uninitialized or destroyed number renderer.");
+			return "";
+		}
+
+		return pimpl_->buffer.data();
+	}
+
+	// Setters
+
+	void NumberRenderer::set_position(penguin::math::Vector2 new_position) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_position() called on an uninitialized or destroyed number renderer.");
+			return;
+		}
+
+		pimpl_->position = new_position;
+		pimpl_->update_geometry();
+	}
+
+	void NumberRenderer::set_colour(penguin::math::Colour new_colour) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_colour() called on an uninitialized or destroyed number renderer.");
+			return;
+		}
+
+		pimpl_->colour = new_colour;
+		pimpl_->update_geometry();
+	}
+
+	void NumberRenderer::set_int(std::int64_t value) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_int() called on an uninitialized or destroyed number renderer.");
+			return;
+		}
+
+		pimpl_->set_int(value);
+	}
+
+	void NumberRenderer::set_float(double value, int precision) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_float() called on an uninitialized or destroyed number renderer.");
+			return;
+		}
+
+		pimpl_->set_float(value, precision);
+	}
+
+	NativeTexturePtr NumberRenderer::get_native_ptr() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_native_ptr() called on an uninitialized or destroyed number renderer.");
+			return NativeTexturePtr{ nullptr };
+		}
+
+		return NativeTexturePtr{ pimpl_->atlas.get() };
+	}
+}
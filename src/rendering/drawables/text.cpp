@@ -1,5 +1,6 @@
 #include <penguin_framework/rendering/drawables/text.hpp>
 #include <rendering/drawables/internal/text_impl.hpp>
+#include <rendering/systems/internal/text_context_impl.hpp>
 #include <penguin_framework/logger/logger.hpp>
 
 namespace penguin::rendering::drawables {
@@ -12,7 +13,7 @@ namespace penguin::rendering::drawables {
 
 		if (font && text_context.is_valid()) { // If the font / text context is invalid, don't bother trying to create it
 			try {
-				pimpl_ = std::make_unique<penguin::internal::rendering::drawables::TextImpl>(text_context.get_native_ptr(), font->get_native_ptr(), str, colour, position);
+				pimpl_ = std::make_unique<penguin::internal::rendering::drawables::TextImpl>(text_context.pimpl_->layout_cache, font, str, colour, position);
 				PF_LOG_INFO("Success: Text created successfully.");
 			}
 			catch (const penguin::internal::error::InternalError& e) {
@@ -48,7 +49,7 @@ namespace penguin::rendering::drawables {
 			return false;
 		}
 
-		return pimpl_->text.get();
+		return pimpl_->layout && pimpl_->layout->text.get();
 	}
 
 	Text::operator bool() const noexcept {
@@ -82,6 +83,24 @@ namespace penguin::rendering::drawables {
 		return pimpl_->str.c_str();;
 	}
 
+	penguin::math::Vector2i Text::get_size() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_size() called on an uninitialized or destroyed text.");
+			return penguin::math::Vector2i::Zero;
+		}
+
+		if (pimpl_->uses_paragraph_layout()) {
+			if (!pimpl_->update_lines()) {
+				PF_LOG_WARNING("Internal_System_Error: Failed to lay out the text.");
+				return penguin::math::Vector2i::Zero;
+			}
+
+			return pimpl_->lines_size;
+		}
+
+		return pimpl_->layout->size;
+	}
+
 	void Text::set_position(penguin::math::Vector2 new_position) {
 		if (!is_valid()) {
 			PF_LOG_WARNING("set_position() called on an uninitialized or destroyed text.");
@@ -98,6 +117,10 @@ namespace penguin::rendering::drawables {
 		}
 
 		pimpl_->colour = new_colour;
+
+		if (pimpl_->baked && !pimpl_->apply_baked_colour()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to apply the colour to the baked text.");
+		}
 	}
 
 	void Text::set_string(const char* new_string) {
@@ -106,7 +129,172 @@ namespace penguin::rendering::drawables {
 			return;
 		}
 
-		pimpl_->str = new_string;
+		bool res = pimpl_->set_string(new_string);
+
+		if (!res) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to update the text string.");
+		}
+	}
+
+	// Paragraph layout
+
+	int Text::get_wrap_width() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_wrap_width() called on an uninitialized or destroyed text.");
+			return 0;
+		}
+
+		return pimpl_->layout_options.wrap_width;
+	}
+
+	penguin::rendering::primitives::TextAlignment Text::get_alignment() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_alignment() called on an uninitialized or destroyed text.");
+			return penguin::rendering::primitives::TextAlignment::Left;
+		}
+
+		return pimpl_->layout_options.alignment;
+	}
+
+	float Text::get_line_spacing() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_line_spacing() called on an uninitialized or destroyed text.");
+			return 1.0f;
+		}
+
+		return pimpl_->layout_options.line_spacing;
+	}
+
+	std::span<const penguin::rendering::primitives::LineMetrics> Text::get_lines() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_lines() called on an uninitialized or destroyed text.");
+			return {};
+		}
+
+		if (!pimpl_->update_lines()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to lay out the text.");
+			return {};
+		}
+
+		return pimpl_->lines;
+	}
+
+	void Text::set_wrap_width(int new_wrap_width) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_wrap_width() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		if (new_wrap_width < 0) {
+			PF_LOG_WARNING("set_wrap_width() called with a negative width, clamping to 0.");
+			new_wrap_width = 0;
+		}
+
+		if (pimpl_->layout_options.wrap_width != new_wrap_width) {
+			pimpl_->layout_options.wrap_width = new_wrap_width;
+			pimpl_->invalidate_lines();
+			rebake_if_needed();
+		}
+	}
+
+	void Text::set_alignment(penguin::rendering::primitives::TextAlignment new_alignment) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_alignment() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		if (pimpl_->layout_options.alignment != new_alignment) {
+			pimpl_->layout_options.alignment = new_alignment;
+			pimpl_->invalidate_lines();
+			rebake_if_needed();
+		}
+	}
+
+	void Text::set_line_spacing(float new_line_spacing) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_line_spacing() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		if (new_line_spacing <= 0.0f) {
+			PF_LOG_WARNING("set_line_spacing() called with a non-positive spacing, ignoring it.");
+			return;
+		}
+
+		if (pimpl_->layout_options.line_spacing != new_line_spacing) {
+			pimpl_->layout_options.line_spacing = new_line_spacing;
+			pimpl_->invalidate_lines();
+			rebake_if_needed();
+		}
+	}
+
+	// Scaled drawing
+
+	float Text::get_scale() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_scale() called on an uninitialized or destroyed text.");
+			return 1.0f;
+		}
+
+		return pimpl_->scale;
+	}
+
+	void Text::set_scale(float new_scale) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_scale() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		if (new_scale <= 0.0f) {
+			PF_LOG_WARNING("set_scale() called with a non-positive scale, ignoring it.");
+			return;
+		}
+
+		pimpl_->scale = new_scale; // applied when drawn, nothing is rasterised again
+	}
+
+	void Text::rebake_if_needed() {
+		if (pimpl_->baked && !pimpl_->bake(pimpl_->baked_renderer)) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to re-bake the text.");
+		}
+	}
+
+	// Static text baking
+
+	void Text::bake(NativeRendererPtr renderer_ptr) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("bake() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		if (!renderer_ptr.ptr) {
+			PF_LOG_WARNING("bake() called with a null renderer.");
+			return;
+		}
+
+		bool res = pimpl_->bake(renderer_ptr.as<SDL_Renderer>());
+
+		if (!res) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to bake the text.");
+		}
+	}
+
+	void Text::unbake() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("unbake() called on an uninitialized or destroyed text.");
+			return;
+		}
+
+		pimpl_->unbake();
+	}
+
+	bool Text::is_baked() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("is_baked() called on an uninitialized or destroyed text.");
+			return false;
+		}
+
+		return pimpl_->baked.get();
 	}
 
 	NativeTextPtr Text::get_native_ptr() const {
@@ -115,6 +303,6 @@ namespace penguin::rendering::drawables {
 			return NativeTextPtr{ nullptr };
 		}
 
-		return NativeTextPtr{ pimpl_->text.get() };
+		return NativeTextPtr{ pimpl_->layout->text.get() };
 	}
 }
\ No newline at end of file
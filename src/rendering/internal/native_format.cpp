@@ -0,0 +1,64 @@
+#include <rendering/internal/native_format.hpp>
+
+namespace penguin::internal::rendering {
+
+	SDL_PixelFormat get_native_texture_format(SDL_Renderer* renderer) {
+		const SDL_PixelFormat fallback = SDL_PIXELFORMAT_ARGB8888; // supported by every SDL renderer
+
+		if (!renderer) {
+			return fallback;
+		}
+
+		// A list ending in SDL_PIXELFORMAT_UNKNOWN, in the renderer's order of preference
+		const auto* formats = static_cast<const SDL_PixelFormat*>(
+			SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+
+		if (!formats) {
+			return fallback;
+		}
+
+		for (const SDL_PixelFormat* format = formats; *format != SDL_PIXELFORMAT_UNKNOWN; ++format) {
+			if (SDL_ISPIXELFORMAT_ALPHA(*format) && !SDL_ISPIXELFORMAT_FOURCC(*format)) {
+				return *format;
+			}
+		}
+
+		return fallback;
+	}
+
+	SDL_Surface* convert_surface(SDL_Surface* surface, SDL_PixelFormat format) {
+		if (!surface || surface->format == format) {
+			return surface;
+		}
+
+		SDL_Surface* converted = SDL_ConvertSurface(surface, format);
+		SDL_DestroySurface(surface);
+
+		return converted;
+	}
+
+	SDL_Surface* prepare_for_upload(SDL_Renderer* renderer, SDL_Surface* source, bool premultiply_alpha) {
+		if (!source) {
+			return nullptr;
+		}
+
+		const SDL_PixelFormat format = get_native_texture_format(renderer);
+
+		if (source->format == format && !premultiply_alpha) {
+			return source; // uploads as is
+		}
+
+		// One conversion here instead of one on every draw (the software renderer blits textures in their own format)
+		SDL_Surface* prepared = source->format == format ? SDL_DuplicateSurface(source) : SDL_ConvertSurface(source, format);
+		if (!prepared) {
+			return nullptr;
+		}
+
+		if (premultiply_alpha && !SDL_PremultiplySurfaceAlpha(prepared, false)) {
+			SDL_DestroySurface(prepared);
+			return nullptr;
+		}
+
+		return prepared;
+	}
+}
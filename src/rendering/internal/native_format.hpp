@@ -0,0 +1,19 @@
+#pragma once
+
+#include <SDL3/SDL_render.h>
+#include <SDL3/SDL_surface.h>
+
+namespace penguin::internal::rendering {
+
+	// The first texture format the renderer lists that has an alpha channel (the renderer's preferred one),
+	// so images in this format are uploaded without a conversion
+	SDL_PixelFormat get_native_texture_format(SDL_Renderer* renderer);
+
+	// Converts the surface to the given format, taking ownership of it. Returns the same surface if it already matches,
+	// and nullptr (with the surface destroyed) if the conversion fails.
+	SDL_Surface* convert_surface(SDL_Surface* surface, SDL_PixelFormat format);
+
+	// Returns a copy of the source in the renderer's native format, with premultiplied alpha if asked for.
+	// The source itself is returned (not copied) when it already matches, so the caller only destroys the result if it differs.
+	SDL_Surface* prepare_for_upload(SDL_Renderer* renderer, SDL_Surface* source, bool premultiply_alpha);
+}
@@ -348,7 +348,32 @@ namespace penguin::internal::rendering {
 		return SDL_RenderTextureRotated(renderer.get(), texture, sdl_source_ptr, sdl_dest_ptr, angle, sdl_anchor_ptr, sdl_mode);
 	}
 
-	bool RendererImpl::draw_text(NativeTextPtr txt_ptr, float x, float y) {
-		return TTF_DrawRendererText(txt_ptr.as<TTF_Text>(), x, y);
+	bool RendererImpl::draw_text(NativeTextPtr txt_ptr, float x, float y, penguin::math::Colour colour, float scale) {
+		TTF_Text* text = txt_ptr.as<TTF_Text>();
+
+		// Layouts are shared between Text objects, so the colour is applied right before each draw
+		if (!TTF_SetTextColorFloat(text, colour.r, colour.g, colour.b, colour.a)) {
+			return false;
+		}
+
+		if (scale == 1.0f) {
+			return TTF_DrawRendererText(text, x, y);
+		}
+
+		// Scale the glyph atlas quads through the render scale, keeping the position in unscaled coordinates
+		float scale_x = 1.0f;
+		float scale_y = 1.0f;
+
+		if (!SDL_GetRenderScale(renderer.get(), &scale_x, &scale_y) || !SDL_SetRenderScale(renderer.get(), scale_x * scale, scale_y * scale)) {
+			return false;
+		}
+
+		bool res = TTF_DrawRendererText(text, x / scale, y / scale);
+
+		return SDL_SetRenderScale(renderer.get(), scale_x, scale_y) && res;
+	}
+
+	bool RendererImpl::draw_geometry(NativeTexturePtr texture, const SDL_Vertex* vertices, int num_vertices, const int* indices, int num_indices) {
+		return SDL_RenderGeometry(renderer.get(), texture.as<SDL_Texture>(), vertices, num_vertices, indices, num_indices);
 	}
 }
\ No newline at end of file
@@ -74,7 +74,11 @@ namespace penguin::internal::rendering {
 
 		// Drawing functions for Text
 
-		bool draw_text(NativeTextPtr txt_ptr, float x, float y);
+		bool draw_text(NativeTextPtr txt_ptr, float x, float y, penguin::math::Colour colour = Colours::White, float scale = 1.0f);
+
+		// Drawing functions for batched geometry
+
+		bool draw_geometry(NativeTexturePtr texture, const SDL_Vertex* vertices, int num_vertices, const int* indices, int num_indices);
 
 	private:
 		bool draw_horizontal_line(float x1, float x2, float y, penguin::math::Colour colour);
@@ -0,0 +1,155 @@
+#include <penguin_framework/rendering/primitives/animated_texture.hpp>
+#include <rendering/primitives/internal/animated_texture_impl.hpp>
+#include <penguin_framework/logger/logger.hpp>
+
+namespace penguin::rendering::primitives {
+
+	AnimatedTexture::AnimatedTexture(NativeRendererPtr renderer_ptr, const char* path) : pimpl_(nullptr) {
+		// Log attempt to create an animated texture
+		PF_LOG_INFO("Attempting to create an animated texture...");
+
+		if (renderer_ptr.ptr && path) {
+			try {
+				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::AnimatedTextureImpl>(renderer_ptr, path);
+				PF_LOG_INFO("Success: Animated texture created successfully, decoding its frames in the background.");
+			}
+			catch (const penguin::internal::error::InternalError& e) {
+				// Get the error code and message
+				std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+				std::string error_message = error_code_str + ": " + e.what();
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+
+			}
+			catch (const std::exception& e) { // Other specific C++ errors
+				// Get error message
+				std::string last_error_message = e.what();
+				std::string error_message = "Unknown_Error: " + last_error_message;
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+			}
+		}
+		else {
+			PF_LOG_ERROR("Texture_Creation_Failed: The renderer is null or has not been initialized, or the path is null.");
+		}
+	}
+
+	AnimatedTexture::~AnimatedTexture() = default;
+
+	AnimatedTexture::AnimatedTexture(AnimatedTexture&&) noexcept = default;
+	AnimatedTexture& AnimatedTexture::operator=(AnimatedTexture&&) noexcept = default;
+
+	// Validity checking
+
+	bool AnimatedTexture::is_valid() const noexcept {
+		if (!pimpl_) {
+			return false;
+		}
+
+		return !pimpl_->failed.load(std::memory_order_acquire);
+	}
+
+	AnimatedTexture::operator bool() const noexcept {
+		return is_valid();
+	}
+
+	bool AnimatedTexture::is_ready() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("is_ready() called on an uninitialized or destroyed animated texture.");
+			return false;
+		}
+
+		return pimpl_->is_ready();
+	}
+
+	// Frames
+
+	AnimationFrame AnimatedTexture::get_frame(int index) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_frame() called on an uninitialized or destroyed animated texture.");
+			return {};
+		}
+
+		AnimationFrame frame = pimpl_->get_frame(index);
+		if (!frame) {
+			std::string error_message = "Internal_System_Error: Failed to get frame " + std::to_string(index) + " of the animated texture.";
+			PF_LOG_WARNING(error_message.c_str());
+		}
+
+		return frame;
+	}
+
+	int AnimatedTexture::get_frame_at(int time_ms, bool loop) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_frame_at() called on an uninitialized or destroyed animated texture.");
+			return 0;
+		}
+
+		if (!pimpl_->wait()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to decode the animated texture.");
+			return 0;
+		}
+
+		return pimpl_->get_frame_at(time_ms, loop);
+	}
+
+	// Getters
+
+	int AnimatedTexture::get_frame_count() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_frame_count() called on an uninitialized or destroyed animated texture.");
+			return 0;
+		}
+
+		if (!pimpl_->wait()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to decode the animated texture.");
+			return 0;
+		}
+
+		return static_cast<int>(pimpl_->delays.size());
+	}
+
+	penguin::math::Vector2i AnimatedTexture::get_frame_size() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_frame_size() called on an uninitialized or destroyed animated texture.");
+			return penguin::math::Vector2i(0, 0);
+		}
+
+		if (!pimpl_->wait()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to decode the animated texture.");
+			return penguin::math::Vector2i(0, 0);
+		}
+
+		return penguin::math::Vector2i(pimpl_->animation->w, pimpl_->animation->h);
+	}
+
+	std::span<const int> AnimatedTexture::get_frame_delays() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_frame_delays() called on an uninitialized or destroyed animated texture.");
+			return {};
+		}
+
+		if (!pimpl_->wait()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to decode the animated texture.");
+			return {};
+		}
+
+		return pimpl_->delays;
+	}
+
+	int AnimatedTexture::get_duration() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_duration() called on an uninitialized or destroyed animated texture.");
+			return 0;
+		}
+
+		if (!pimpl_->wait()) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to decode the animated texture.");
+			return 0;
+		}
+
+		return pimpl_->duration;
+	}
+}
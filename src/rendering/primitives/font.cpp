@@ -1,5 +1,6 @@
 #include <penguin_framework/rendering/primitives/font.hpp>
 #include <rendering/primitives/internal/font_impl.hpp>
+#include <rendering/primitives/internal/line_breaker.hpp>
 #include <penguin_framework/logger/logger.hpp>
 
 namespace penguin::rendering::primitives {
@@ -32,6 +33,34 @@ namespace penguin::rendering::primitives {
 		}
 	}
 
+	Font::Font(std::shared_ptr<const std::vector<unsigned char>> font_data, float size, int outline) : pimpl_(nullptr) {
+
+		// Log attempt to create a font
+		PF_LOG_INFO("Attempting to create font from memory...");
+
+		try {
+			pimpl_ = std::make_unique<penguin::internal::rendering::primitives::FontImpl>(std::move(font_data), size, outline);
+			PF_LOG_INFO("Success: Font created successfully.");
+		}
+		catch (const penguin::internal::error::InternalError& e) {
+			// Get the error code and message
+			std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+			std::string error_message = error_code_str + ": " + e.what();
+
+			// Log the error
+			PF_LOG_ERROR(error_message.c_str());
+
+		}
+		catch (const std::exception& e) { // Other specific C++ errors
+			// Get error message
+			std::string last_error_message = e.what();
+			std::string error_message = "Unknown_Error: " + last_error_message;
+
+			// Log the error
+			PF_LOG_ERROR(error_message.c_str());
+		}
+	}
+
 	Font::~Font() = default;
 
 	Font::Font(Font&&) noexcept = default;
@@ -184,6 +213,69 @@ namespace penguin::rendering::primitives {
 		pimpl_->make_normal();
 	}
 
+	void Font::set_sdf(bool enabled) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_sdf() called on an uninitialized or destroyed font.");
+			return;
+		}
+
+		if (!TTF_SetFontSDF(pimpl_->font.get(), enabled)) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to change the signed distance field mode of the font.");
+		}
+	}
+
+	bool Font::is_sdf() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("is_sdf() called on an uninitialized or destroyed font.");
+			return false;
+		}
+
+		return TTF_GetFontSDF(pimpl_->font.get());
+	}
+
+	int Font::prewarm(const char* charset) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("prewarm() called on an uninitialized or destroyed font.");
+			return 0;
+		}
+
+		if (!charset) {
+			PF_LOG_WARNING("prewarm() called with a null charset.");
+			return 0;
+		}
+
+		return pimpl_->prewarm(charset);
+	}
+
+	TextMetrics Font::measure(const char* str, int wrap_width) const {
+		TextMetrics metrics{ penguin::math::Vector2i::Zero, {} };
+		measure(str, wrap_width, metrics);
+
+		return metrics;
+	}
+
+	bool Font::measure(const char* str, int wrap_width, TextMetrics& metrics) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("measure() called on an uninitialized or destroyed font.");
+			return false;
+		}
+
+		if (!str) {
+			PF_LOG_WARNING("measure() called with a null string.");
+			return false;
+		}
+
+		penguin::internal::rendering::primitives::LineBreakOptions options;
+		options.wrap_width = wrap_width;
+
+		if (!penguin::internal::rendering::primitives::break_lines(pimpl_->font.get(), str, options, metrics.lines, metrics.size)) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to measure the string.");
+			return false;
+		}
+
+		return true;
+	}
+
 	NativeFontPtr Font::get_native_ptr() {
 		if (!is_valid()) {
 			PF_LOG_WARNING("get_native_ptr() called on an uninitialized or destroyed font.");
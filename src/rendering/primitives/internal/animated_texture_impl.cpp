@@ -0,0 +1,147 @@
+#include <rendering/primitives/internal/animated_texture_impl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace penguin::internal::rendering::primitives {
+
+    AnimatedTextureImpl::AnimatedTextureImpl(NativeRendererPtr p_renderer, const char* path) : renderer(p_renderer.as<SDL_Renderer>()) {
+        SDL_IOStream* stream = SDL_IOFromFile(path, "rb");
+
+        penguin::internal::error::InternalError::throw_if(
+            !stream,
+            "Failed to open the animated image.",
+            penguin::internal::error::ErrorCode::Texture_Creation_Failed
+        );
+
+        // SDL_image decodes every frame in one call, so it runs off the render thread
+        decoding = std::async(std::launch::async, [this, stream]() {
+            IMG_Animation* result = IMG_LoadAnimation_IO(stream, true);
+
+            if (!result || result->count <= 0 || result->w <= 0 || result->h <= 0) {
+                failed.store(true, std::memory_order_release);
+            }
+
+            return result;
+        });
+    }
+
+    AnimatedTextureImpl::~AnimatedTextureImpl() {
+        if (decoding.valid()) {
+            IMG_FreeAnimation(decoding.get()); // never taken, waits for the decode to finish
+        }
+    }
+
+    bool AnimatedTextureImpl::wait() {
+        if (decoding.valid()) {
+            animation.reset(decoding.get());
+
+            if (!failed.load(std::memory_order_acquire)) {
+                const int max_size = static_cast<int>(SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 4096));
+                const int max_columns = max_size / animation->w;
+                const int max_rows = max_size / animation->h;
+
+                if (max_columns < 1 || max_rows < 1) {
+                    failed.store(true, std::memory_order_release); // a single frame is larger than a texture can be
+                }
+                else {
+                    // Square pages where possible, so the atlas stays well within the renderer's limits
+                    columns = std::min(max_columns, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(animation->count)))));
+                    frames_per_page = columns * max_rows;
+                    pages.resize((animation->count + frames_per_page - 1) / frames_per_page);
+                    uploaded.assign(animation->count, false);
+
+                    delays.reserve(animation->count);
+                    start_times.reserve(animation->count);
+
+                    for (int i = 0; i < animation->count; ++i) {
+                        delays.push_back(animation->delays[i] <= 10 ? 100 : animation->delays[i]);
+                        start_times.push_back(duration);
+                        duration += delays.back();
+                    }
+                }
+            }
+        }
+
+        return !failed.load(std::memory_order_acquire);
+    }
+
+    bool AnimatedTextureImpl::is_ready() const {
+        return !decoding.valid() || decoding.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    penguin::rendering::primitives::AnimationFrame AnimatedTextureImpl::get_frame(int index) {
+        if (!wait() || index < 0 || index >= animation->count) {
+            return {};
+        }
+
+        if (!uploaded[index] && !upload(index)) {
+            return {};
+        }
+
+        const int cell = index % frames_per_page;
+        const float w = static_cast<float>(animation->w);
+        const float h = static_cast<float>(animation->h);
+
+        return { pages[index / frames_per_page], penguin::math::Rect2((cell % columns) * w, (cell / columns) * h, w, h), delays[index] };
+    }
+
+    int AnimatedTextureImpl::get_frame_at(int time_ms, bool loop) {
+        if (!wait() || duration <= 0) {
+            return 0;
+        }
+
+        if (time_ms < 0) {
+            time_ms = 0;
+        }
+
+        time_ms = loop ? time_ms % duration : std::min(time_ms, duration - 1);
+
+        // The last frame starting at or before the time
+        return static_cast<int>(std::upper_bound(start_times.begin(), start_times.end(), time_ms) - start_times.begin()) - 1;
+    }
+
+    bool AnimatedTextureImpl::upload(int index) {
+        const int page = index / frames_per_page;
+
+        if (!pages[page]) {
+            auto new_page = std::make_shared<penguin::rendering::primitives::Texture>(NativeRendererPtr{ renderer }, get_page_size(page));
+            if (!new_page->is_valid()) {
+                return false;
+            }
+
+            pages[page] = std::move(new_page);
+        }
+
+        SDL_Surface* frame = animation->frames[index];
+        SDL_Surface* converted = frame->format == SDL_PIXELFORMAT_ARGB8888 ? frame : SDL_ConvertSurface(frame, SDL_PIXELFORMAT_ARGB8888);
+        if (!converted) {
+            return false;
+        }
+
+        const int cell = index % frames_per_page;
+        const SDL_Rect rect = { (cell % columns) * animation->w, (cell / columns) * animation->h, animation->w, animation->h };
+        const bool updated = SDL_UpdateTexture(pages[page]->get_native_ptr().as<SDL_Texture>(), &rect, converted->pixels, converted->pitch);
+
+        if (converted != frame) {
+            SDL_DestroySurface(converted);
+        }
+
+        if (updated) {
+            // On the GPU now, the decoded copy is no longer needed
+            SDL_DestroySurface(frame);
+            animation->frames[index] = nullptr;
+            uploaded[index] = true;
+        }
+
+        return updated;
+    }
+
+    penguin::math::Vector2i AnimatedTextureImpl::get_page_size(int page) const {
+        const int frames_on_page = std::min(frames_per_page, animation->count - page * frames_per_page);
+        const int rows = (frames_on_page + columns - 1) / columns;
+
+        return penguin::math::Vector2i(std::min(columns, frames_on_page) * animation->w, rows * animation->h);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/rendering/primitives/texture.hpp>
+#include <penguin_framework/rendering/primitives/animated_texture.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+
+#include <error/internal/internal_error.hpp>
+
+#include <SDL3/SDL_render.h>
+#include <SDL3_image/SDL_image.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace penguin::internal::rendering::primitives {
+
+	struct AnimatedTextureImpl {
+		SDL_Renderer* renderer;
+		std::future<IMG_Animation*> decoding; // valid until wait() takes the result
+		std::atomic<bool> failed{ false };
+
+		std::unique_ptr<IMG_Animation, void(*)(IMG_Animation*)> animation{ nullptr, &IMG_FreeAnimation }; // frames are freed once uploaded
+		std::vector<int> delays;
+		std::vector<int> start_times; // of each frame, for looking frames up by time
+		int duration = 0;
+
+		// The atlas: frames are laid out row by row, columns per row and frames_per_page per page
+		std::vector<std::shared_ptr<penguin::rendering::primitives::Texture>> pages;
+		std::vector<bool> uploaded;
+		int columns = 0;
+		int frames_per_page = 0;
+
+		// Constructor
+		AnimatedTextureImpl(NativeRendererPtr p_renderer, const char* path);
+		~AnimatedTextureImpl();
+
+		// Copy & move (including assigment) not allowed
+
+		AnimatedTextureImpl(const AnimatedTextureImpl&) = delete;
+		AnimatedTextureImpl& operator=(const AnimatedTextureImpl&) = delete;
+		AnimatedTextureImpl(AnimatedTextureImpl&&) noexcept = delete;
+		AnimatedTextureImpl& operator=(AnimatedTextureImpl&&) noexcept = delete;
+
+		bool wait(); // takes the decoded frames and lays out the atlas, false if decoding failed
+		bool is_ready() const;
+		penguin::rendering::primitives::AnimationFrame get_frame(int index);
+		int get_frame_at(int time_ms, bool loop);
+
+	private:
+		bool upload(int index);
+		penguin::math::Vector2i get_page_size(int page) const;
+	};
+}
@@ -1,4 +1,6 @@
 #include <rendering/primitives/internal/font_impl.hpp>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_stdinc.h>
 #include <string>
 
 namespace penguin::internal::rendering::primitives {
@@ -19,6 +21,32 @@ namespace penguin::internal::rendering::primitives {
         underline = false;
         strikethrough = false;
     }
+
+    FontImpl::FontImpl(std::shared_ptr<const std::vector<unsigned char>> p_data, float p_size, int p_outline) : data(std::move(p_data)), font(nullptr, &TTF_CloseFont) {
+        penguin::internal::error::InternalError::throw_if(
+            !data || data->empty(),
+            "The font data is null or empty.",
+            penguin::internal::error::ErrorCode::Null_Argument
+        );
+
+        // Each font gets its own stream over the shared buffer, the buffer itself is never copied
+        font.reset(TTF_OpenFontIO(SDL_IOFromConstMem(data->data(), data->size()), true, p_size));
+
+        penguin::internal::error::InternalError::throw_if(
+            !font,
+            "Failed to create the font.",
+            penguin::internal::error::ErrorCode::Font_Creation_Failed
+        );
+
+        size = p_size;
+        outline = p_outline;
+        applied_styles = TTF_STYLE_NORMAL;
+        normal = true;
+        bold = false;
+        italic = false;
+        underline = false;
+        strikethrough = false;
+    }
     
     void FontImpl::make_normal() {
         normal = true;
@@ -75,4 +103,27 @@ namespace penguin::internal::rendering::primitives {
         TTF_SetFontStyle(font.get(), applied_styles);
     }
 
-}
\ No newline at end of file
+
+    int FontImpl::prewarm(std::string_view charset) {
+        const char* cursor = charset.data();
+        std::size_t remaining = charset.size();
+        int cached = 0;
+
+        while (remaining > 0) {
+            Uint32 codepoint = SDL_StepUTF8(&cursor, &remaining);
+
+            if (!TTF_FontHasGlyph(font.get(), codepoint)) {
+                continue; // would only rasterise the missing glyph box
+            }
+
+            // Getting the image rasterises the glyph into the font's cache, the returned copy is not needed
+            SDL_Surface* image = TTF_GetGlyphImage(font.get(), codepoint, nullptr);
+            if (image) {
+                SDL_DestroySurface(image);
+                ++cached;
+            }
+        }
+
+        return cached;
+    }
+}
@@ -8,10 +8,13 @@
 #include <memory>
 #include <array>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace penguin::internal::rendering::primitives {
 
     struct FontImpl {
+        std::shared_ptr<const std::vector<unsigned char>> data; // in-memory font file, must outlive the font
         std::unique_ptr<TTF_Font, void(*)(TTF_Font*)> font;
         float size;
         int outline;
@@ -24,11 +27,14 @@ namespace penguin::internal::rendering::primitives {
         std::string applied_styles_str;
 
         FontImpl(const char* path, float p_size = 12.0f, int p_outline = 1);
+        FontImpl(std::shared_ptr<const std::vector<unsigned char>> p_data, float p_size = 12.0f, int p_outline = 1);
 
         void make_normal();
         void make_bold(); 
         void make_italic();
         void make_underline();
         void make_strikethrough();
+
+        int prewarm(std::string_view charset);
     };
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <rendering/primitives/internal/line_breaker.hpp>
+
+#include <algorithm>
+
+namespace penguin::internal::rendering::primitives {
+
+	namespace {
+		bool is_space(char c) {
+			return c == ' ' || c == '\t';
+		}
+
+		// Length in bytes of the UTF-8 sequence starting the string, so a forced break never splits a codepoint
+		std::size_t codepoint_length(std::string_view str) {
+			std::size_t length = 1;
+
+			while (length < str.size() && (static_cast<unsigned char>(str[length]) & 0xC0) == 0x80) {
+				++length;
+			}
+
+			return length;
+		}
+
+		// TTF_MeasureString reads a length of 0 as "NUL-terminated", which would measure the rest of the string,
+		// so empty lines (blank paragraphs, a trailing newline, a wrapped line of only spaces) are 0 wide without asking it
+		bool measure_string(TTF_Font* font, std::string_view str, int wrap_width, int* width, std::size_t* fit) {
+			if (str.empty()) {
+				*width = 0;
+				if (fit) {
+					*fit = 0;
+				}
+
+				return true;
+			}
+
+			return TTF_MeasureString(font, str.data(), str.size(), wrap_width, width, fit);
+		}
+	}
+
+	bool break_lines(TTF_Font* font, std::string_view str, const LineBreakOptions& options,
+		std::vector<penguin::rendering::primitives::LineMetrics>& lines, penguin::math::Vector2i& size) {
+		using penguin::rendering::primitives::TextAlignment;
+
+		lines.clear();
+		size = penguin::math::Vector2i::Zero;
+
+		if (!font) {
+			return false;
+		}
+
+		const int wrap_width = std::max(options.wrap_width, 0);
+		const float line_height = static_cast<float>(TTF_GetFontHeight(font));
+		const float line_advance = static_cast<float>(TTF_GetFontLineSkip(font)) * options.line_spacing;
+		int widest = 0;
+
+		std::size_t paragraph_start = 0;
+
+		while (true) {
+			std::size_t paragraph_end = str.find('\n', paragraph_start);
+			if (paragraph_end == std::string_view::npos) {
+				paragraph_end = str.size();
+			}
+
+			std::size_t start = paragraph_start;
+
+			do {
+				std::string_view remaining = str.substr(start, paragraph_end - start);
+				std::size_t line_length = remaining.size();
+				std::size_t next = paragraph_end;
+				int width = 0;
+				std::size_t fit = 0;
+
+				if (!measure_string(font, remaining, wrap_width, &width, &fit)) {
+					lines.clear();
+					return false;
+				}
+
+				if (wrap_width > 0 && fit < remaining.size()) {
+					// Back up to the last space that fits, so words stay whole
+					std::size_t brk = fit;
+					while (brk > 0 && !is_space(remaining[brk])) {
+						--brk;
+					}
+
+					if (brk == 0) { // a single word wider than the line, split it
+						brk = fit > 0 ? fit : codepoint_length(remaining);
+					}
+
+					next = start + brk;
+					while (next < paragraph_end && is_space(str[next])) { // the spaces the line broke on are not carried over
+						++next;
+					}
+
+					line_length = brk;
+					while (line_length > 0 && is_space(remaining[line_length - 1])) {
+						--line_length;
+					}
+
+					if (!measure_string(font, remaining.substr(0, line_length), 0, &width, nullptr)) {
+						lines.clear();
+						return false;
+					}
+				}
+
+				float y = static_cast<float>(lines.size()) * line_advance;
+				lines.push_back({ start, line_length, penguin::math::Rect2(0.0f, y, static_cast<float>(width), line_height) });
+				widest = std::max(widest, width);
+
+				start = next;
+			} while (start < paragraph_end);
+
+			if (paragraph_end == str.size()) {
+				break;
+			}
+
+			paragraph_start = paragraph_end + 1;
+		}
+
+		// Wrapped text is aligned within the wrap width, unwrapped text within its widest line
+		const int box_width = (wrap_width > 0 && options.alignment != TextAlignment::Left) ? std::max(wrap_width, widest) : widest;
+
+		if (options.alignment != TextAlignment::Left) {
+			for (penguin::rendering::primitives::LineMetrics& line : lines) {
+				float free_space = static_cast<float>(box_width) - line.bounds.size.x;
+				line.bounds.position.x = options.alignment == TextAlignment::Center ? free_space * 0.5f : free_space;
+			}
+		}
+
+		size.x = box_width;
+		size.y = static_cast<int>(lines.back().bounds.position.y + line_height);
+
+		return true;
+	}
+}
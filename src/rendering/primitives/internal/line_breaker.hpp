@@ -0,0 +1,24 @@
+#pragma once
+
+#include <penguin_framework/rendering/primitives/text_metrics.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include <string_view>
+#include <vector>
+
+namespace penguin::internal::rendering::primitives {
+
+	struct LineBreakOptions {
+		int wrap_width = 0; // 0 only breaks on newlines
+		penguin::rendering::primitives::TextAlignment alignment = penguin::rendering::primitives::TextAlignment::Left;
+		float line_spacing = 1.0f; // multiplier on the font's line skip
+	};
+
+	// Breaks the string into lines at word boundaries, measuring each line once with TTF_MeasureString.
+	// Words wider than the wrap width are split at the last glyph that fits.
+	// Returns false if the font could not measure the string, leaving the lines empty.
+	bool break_lines(TTF_Font* font, std::string_view str, const LineBreakOptions& options,
+		std::vector<penguin::rendering::primitives::LineMetrics>& lines, penguin::math::Vector2i& size);
+}
@@ -0,0 +1,80 @@
+#include <rendering/primitives/internal/streaming_texture_impl.hpp>
+
+#include <algorithm>
+
+namespace penguin::internal::rendering::primitives {
+
+    StreamingTextureImpl::StreamingTextureImpl(NativeRendererPtr renderer, penguin::math::Vector2i p_size, bool p_triple_buffered)
+        : texture(std::make_shared<penguin::rendering::primitives::Texture>(renderer, p_size)), size(p_size), triple_buffered(p_triple_buffered) {
+        penguin::internal::error::InternalError::throw_if(
+            !texture->is_valid(),
+            "Failed to create the streaming texture.",
+            penguin::internal::error::ErrorCode::Texture_Creation_Failed
+        );
+
+        if (triple_buffered) {
+            for (std::vector<std::uint32_t>& frame : frames) {
+                frame.assign(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y), 0u);
+            }
+        }
+    }
+
+    penguin::rendering::primitives::PixelBuffer StreamingTextureImpl::lock(const penguin::math::Rect2i& rect, bool keep_contents) {
+        if (!triple_buffered) {
+            SDL_Rect area{ rect.position.x, rect.position.y, rect.size.x, rect.size.y };
+            void* pixels = nullptr;
+            int pitch = 0;
+
+            // SDL keeps the pixels outside the locked area, the area itself is write-only either way
+            if (!SDL_LockTexture(get_native(), &area, &pixels, &pitch)) {
+                return {};
+            }
+
+            locked = true;
+
+            const int pitch_pixels = pitch / static_cast<int>(sizeof(std::uint32_t));
+            const std::size_t count = static_cast<std::size_t>(rect.size.y - 1) * pitch_pixels + rect.size.x;
+            return { std::span<std::uint32_t>(static_cast<std::uint32_t*>(pixels), count), pitch_pixels, rect.size };
+        }
+
+        std::vector<std::uint32_t>& frame = frames[write_index];
+
+        // The write frame may be two frames old, so a partial update starts from the newest published frame.
+        // That frame is only ever read by the render thread, so reading it here is safe.
+        if (keep_contents && published_index != No_Frame && published_index != write_index) {
+            std::copy(frames[published_index].begin(), frames[published_index].end(), frame.begin());
+        }
+
+        locked = true;
+
+        const std::size_t first = static_cast<std::size_t>(rect.position.y) * size.x + rect.position.x;
+        const std::size_t count = static_cast<std::size_t>(rect.size.y - 1) * size.x + rect.size.x;
+        return { std::span<std::uint32_t>(frame.data() + first, count), size.x, rect.size };
+    }
+
+    void StreamingTextureImpl::unlock() {
+        locked = false;
+
+        if (!triple_buffered) {
+            SDL_UnlockTexture(get_native());
+            return;
+        }
+
+        // Publish the frame and take back whichever frame was waiting (an older unpublished one, or the one last uploaded)
+        const std::uint32_t previous = ready_state.exchange(write_index | Fresh_Frame, std::memory_order_acq_rel);
+        published_index = write_index;
+        write_index = previous & ~Fresh_Frame;
+    }
+
+    bool StreamingTextureImpl::upload() {
+        if (!triple_buffered || !(ready_state.load(std::memory_order_acquire) & Fresh_Frame)) {
+            return false; // nothing new since the last upload
+        }
+
+        // Only the producer sets the fresh flag, so the frame taken here is the newest one
+        const std::uint32_t previous = ready_state.exchange(upload_index, std::memory_order_acq_rel);
+        upload_index = previous & ~Fresh_Frame;
+
+        return SDL_UpdateTexture(get_native(), nullptr, frames[upload_index].data(), size.x * static_cast<int>(sizeof(std::uint32_t)));
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <penguin_framework/common/native_types.hpp>
+#include <penguin_framework/rendering/primitives/texture.hpp>
+#include <penguin_framework/rendering/primitives/streaming_texture.hpp>
+#include <penguin_framework/math/rect2i.hpp>
+#include <penguin_framework/math/vector2i.hpp>
+
+#include <error/internal/internal_error.hpp>
+
+#include <SDL3/SDL_render.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace penguin::internal::rendering::primitives {
+
+	struct StreamingTextureImpl {
+		std::shared_ptr<penguin::rendering::primitives::Texture> texture;
+		penguin::math::Vector2i size;
+		bool triple_buffered;
+		bool locked = false;
+
+		// Triple buffering: the producer owns write_index, the render thread owns upload_index, and the frame in between
+		// is swapped atomically, so neither side ever waits. The ready state packs the frame index with a fresh flag.
+		static constexpr std::uint32_t Fresh_Frame = 0x4;
+		static constexpr std::uint32_t No_Frame = 0xFF;
+
+		std::array<std::vector<std::uint32_t>, 3> frames;
+		std::atomic<std::uint32_t> ready_state{ 1 };
+		std::uint32_t write_index = 0;
+		std::uint32_t upload_index = 2;
+		std::uint32_t published_index = No_Frame; // producer side, the newest frame it published
+
+		// Constructor
+		StreamingTextureImpl(NativeRendererPtr renderer, penguin::math::Vector2i p_size, bool p_triple_buffered);
+
+		// Copy & move (including assigment) not allowed
+
+		StreamingTextureImpl(const StreamingTextureImpl&) = delete;
+		StreamingTextureImpl& operator=(const StreamingTextureImpl&) = delete;
+		StreamingTextureImpl(StreamingTextureImpl&&) noexcept = delete;
+		StreamingTextureImpl& operator=(StreamingTextureImpl&&) noexcept = delete;
+
+		penguin::rendering::primitives::PixelBuffer lock(const penguin::math::Rect2i& rect, bool keep_contents);
+		void unlock();
+		bool upload();
+
+	private:
+		SDL_Texture* get_native() const { return texture->get_native_ptr().as<SDL_Texture>(); }
+	};
+}
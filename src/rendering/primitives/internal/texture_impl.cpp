@@ -1,9 +1,11 @@
 #include <rendering/primitives/internal/texture_impl.hpp>
+#include <rendering/internal/native_format.hpp>
 #include <SDL3_image/SDL_image.h>
 
 namespace penguin::internal::rendering::primitives {
 
-	TextureImpl::TextureImpl(NativeRendererPtr ptr, const char* path) : texture(IMG_LoadTexture(ptr.as<SDL_Renderer>(), path), &SDL_DestroyTexture) {
+	TextureImpl::TextureImpl(NativeRendererPtr ptr, const char* path, penguin::rendering::primitives::AlphaMode p_alpha_mode)
+		: texture(upload(ptr.as<SDL_Renderer>(), path, p_alpha_mode), &SDL_DestroyTexture), alpha_mode(p_alpha_mode) {
 		penguin::internal::error::InternalError::throw_if(
 			!texture,
 			"Failed to create the texture.",
@@ -13,4 +15,62 @@ namespace penguin::internal::rendering::primitives {
 		size.x = texture->w;
 		size.y = texture->h;
 	}
+
+	TextureImpl::TextureImpl(NativeRendererPtr ptr, SDL_Surface* surface, penguin::rendering::primitives::AlphaMode p_alpha_mode)
+		: texture(upload(ptr.as<SDL_Renderer>(), surface, p_alpha_mode), &SDL_DestroyTexture), alpha_mode(p_alpha_mode) {
+		penguin::internal::error::InternalError::throw_if(
+			!texture,
+			"Failed to create the texture from the surface.",
+			penguin::internal::error::ErrorCode::Texture_Creation_Failed
+		);
+
+		size.x = texture->w;
+		size.y = texture->h;
+	}
+
+	TextureImpl::TextureImpl(NativeRendererPtr ptr, penguin::math::Vector2i p_size)
+		: texture(SDL_CreateTexture(ptr.as<SDL_Renderer>(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, p_size.x, p_size.y), &SDL_DestroyTexture),
+		alpha_mode(penguin::rendering::primitives::AlphaMode::Straight) {
+		penguin::internal::error::InternalError::throw_if(
+			!texture,
+			"Failed to create the streaming texture.",
+			penguin::internal::error::ErrorCode::Texture_Creation_Failed
+		);
+
+		size.x = texture->w;
+		size.y = texture->h;
+	}
+
+	SDL_Texture* TextureImpl::upload(SDL_Renderer* renderer, SDL_Surface* surface, penguin::rendering::primitives::AlphaMode alpha_mode) {
+		const bool premultiplied = alpha_mode == penguin::rendering::primitives::AlphaMode::Premultiplied;
+
+		SDL_Surface* prepared = penguin::internal::rendering::prepare_for_upload(renderer, surface, premultiplied);
+		if (!prepared) {
+			return nullptr;
+		}
+
+		SDL_Texture* new_texture = SDL_CreateTextureFromSurface(renderer, prepared);
+
+		if (prepared != surface) {
+			SDL_DestroySurface(prepared); // the caller's surface is left alone
+		}
+
+		if (new_texture && premultiplied) {
+			SDL_SetTextureBlendMode(new_texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+		}
+
+		return new_texture;
+	}
+
+	SDL_Texture* TextureImpl::upload(SDL_Renderer* renderer, const char* path, penguin::rendering::primitives::AlphaMode alpha_mode) {
+		SDL_Surface* surface = IMG_Load(path);
+		if (!surface) {
+			return nullptr;
+		}
+
+		SDL_Texture* new_texture = upload(renderer, surface, alpha_mode);
+		SDL_DestroySurface(surface);
+
+		return new_texture;
+	}
 }
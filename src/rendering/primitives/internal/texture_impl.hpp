@@ -7,6 +7,7 @@
 #include <penguin_framework/math/circle2.hpp>
 #include <penguin_framework/math/colours.hpp>
 #include <penguin_framework/math/vector2i.hpp>
+#include <penguin_framework/rendering/primitives/alpha_mode.hpp>
 
 #include <SDL3/SDL_video.h>
 #include <SDL3/SDL_render.h>
@@ -20,14 +21,22 @@ namespace penguin::internal::rendering::primitives {
 	struct TextureImpl {
 		std::unique_ptr <SDL_Texture, void(*)(SDL_Texture*)> texture;
 		penguin::math::Vector2i size;
+		penguin::rendering::primitives::AlphaMode alpha_mode;
 
 		// Constructor
-		TextureImpl(NativeRendererPtr ptr, const char* path);
+		TextureImpl(NativeRendererPtr ptr, const char* path, penguin::rendering::primitives::AlphaMode p_alpha_mode);
+		TextureImpl(NativeRendererPtr ptr, SDL_Surface* surface, penguin::rendering::primitives::AlphaMode p_alpha_mode);
+		TextureImpl(NativeRendererPtr ptr, penguin::math::Vector2i p_size); // blank, streaming, 32-bit ARGB
 
 		TextureImpl(const TextureImpl&) = delete;
 		TextureImpl& operator=(const TextureImpl&) = delete;
 		TextureImpl(TextureImpl&&) noexcept = default;
 		TextureImpl& operator=(TextureImpl&&) noexcept = default;
+
+	private:
+		// Uploads the surface in the renderer's native format, nullptr on failure
+		static SDL_Texture* upload(SDL_Renderer* renderer, SDL_Surface* surface, penguin::rendering::primitives::AlphaMode alpha_mode);
+		static SDL_Texture* upload(SDL_Renderer* renderer, const char* path, penguin::rendering::primitives::AlphaMode alpha_mode);
 	};
 
 }
\ No newline at end of file
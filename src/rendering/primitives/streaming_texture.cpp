@@ -0,0 +1,159 @@
+#include <penguin_framework/rendering/primitives/streaming_texture.hpp>
+#include <rendering/primitives/internal/streaming_texture_impl.hpp>
+#include <penguin_framework/logger/logger.hpp>
+
+namespace penguin::rendering::primitives {
+
+	StreamingTexture::StreamingTexture(NativeRendererPtr renderer_ptr, penguin::math::Vector2i size, bool triple_buffered) : pimpl_(nullptr) {
+		// Log attempt to create a streaming texture
+		PF_LOG_INFO("Attempting to create a streaming texture...");
+
+		if (renderer_ptr.ptr && size.x > 0 && size.y > 0) {
+			try {
+				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::StreamingTextureImpl>(renderer_ptr, size, triple_buffered);
+				PF_LOG_INFO("Success: Streaming texture created successfully.");
+			}
+			catch (const penguin::internal::error::InternalError& e) {
+				// Get the error code and message
+				std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+				std::string error_message = error_code_str + ": " + e.what();
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+
+			}
+			catch (const std::exception& e) { // Other specific C++ errors
+				// Get error message
+				std::string last_error_message = e.what();
+				std::string error_message = "Unknown_Error: " + last_error_message;
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+			}
+		}
+		else {
+			PF_LOG_ERROR("Texture_Creation_Failed: The renderer is null or has not been initialized, or the size is not positive.");
+		}
+	}
+
+	StreamingTexture::~StreamingTexture() {
+		if (pimpl_ && pimpl_->locked) {
+			pimpl_->unlock(); // never leave the SDL texture locked
+		}
+	}
+
+	StreamingTexture::StreamingTexture(StreamingTexture&&) noexcept = default;
+	StreamingTexture& StreamingTexture::operator=(StreamingTexture&&) noexcept = default;
+
+	// Validity checking
+
+	bool StreamingTexture::is_valid() const noexcept {
+		if (!pimpl_) {
+			return false;
+		}
+
+		return pimpl_->texture && pimpl_->texture->is_valid();
+	}
+
+	StreamingTexture::operator bool() const noexcept {
+		return is_valid();
+	}
+
+	// Writing pixels
+
+	PixelBuffer StreamingTexture::lock() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("lock() called on an uninitialized or destroyed streaming texture.");
+			return {};
+		}
+
+		if (pimpl_->locked) {
+			PF_LOG_WARNING("lock() called on a streaming texture that is already locked.");
+			return {};
+		}
+
+		return pimpl_->lock(penguin::math::Rect2i(penguin::math::Vector2i(0, 0), pimpl_->size), false);
+	}
+
+	PixelBuffer StreamingTexture::lock(const penguin::math::Rect2i& rect) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("lock() called on an uninitialized or destroyed streaming texture.");
+			return {};
+		}
+
+		if (pimpl_->locked) {
+			PF_LOG_WARNING("lock() called on a streaming texture that is already locked.");
+			return {};
+		}
+
+		const penguin::math::Vector2i size = pimpl_->size;
+		if (rect.size.x <= 0 || rect.size.y <= 0 || rect.position.x < 0 || rect.position.y < 0
+			|| rect.position.x + rect.size.x > size.x || rect.position.y + rect.size.y > size.y) {
+			PF_LOG_WARNING("lock() called with a region outside of the streaming texture.");
+			return {};
+		}
+
+		return pimpl_->lock(rect, true);
+	}
+
+	void StreamingTexture::unlock() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("unlock() called on an uninitialized or destroyed streaming texture.");
+			return;
+		}
+
+		if (!pimpl_->locked) {
+			PF_LOG_WARNING("unlock() called on a streaming texture that is not locked.");
+			return;
+		}
+
+		pimpl_->unlock();
+	}
+
+	bool StreamingTexture::upload() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("upload() called on an uninitialized or destroyed streaming texture.");
+			return false;
+		}
+
+		return pimpl_->upload();
+	}
+
+	// Getters
+
+	std::shared_ptr<Texture> StreamingTexture::get_texture() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_texture() called on an uninitialized or destroyed streaming texture.");
+			return nullptr;
+		}
+
+		return pimpl_->texture;
+	}
+
+	penguin::math::Vector2i StreamingTexture::get_size() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_size() called on an uninitialized or destroyed streaming texture.");
+			return penguin::math::Vector2i(0, 0);
+		}
+
+		return pimpl_->size;
+	}
+
+	bool StreamingTexture::is_triple_buffered() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("is_triple_buffered() called on an uninitialized or destroyed streaming texture.");
+			return false;
+		}
+
+		return pimpl_->triple_buffered;
+	}
+
+	bool StreamingTexture::is_locked() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("is_locked() called on an uninitialized or destroyed streaming texture.");
+			return false;
+		}
+
+		return pimpl_->locked;
+	}
+}
@@ -4,13 +4,13 @@
 
 namespace penguin::rendering::primitives {
 
-	Texture::Texture(NativeRendererPtr renderer_ptr, const char* path) : pimpl_(nullptr) {
+	Texture::Texture(NativeRendererPtr renderer_ptr, const char* path, AlphaMode alpha_mode) : pimpl_(nullptr) {
 		// Log attempt to create a texture
 		PF_LOG_INFO("Attempting to create a texture...");
 
 		if (renderer_ptr.ptr) {
 			try {
-				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::TextureImpl>(renderer_ptr, path);
+				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::TextureImpl>(renderer_ptr, path, alpha_mode);
 				PF_LOG_INFO("Success: Texture created successfully.");
 			}
 			catch (const penguin::internal::error::InternalError& e) {
@@ -36,6 +36,70 @@ namespace penguin::rendering::primitives {
 		}
 	}
 
+	Texture::Texture(NativeRendererPtr renderer_ptr, NativeSurfacePtr surface_ptr, AlphaMode alpha_mode) : pimpl_(nullptr) {
+		// Log attempt to create a texture
+		PF_LOG_INFO("Attempting to create a texture from a surface...");
+
+		if (renderer_ptr.ptr && surface_ptr.ptr) {
+			try {
+				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::TextureImpl>(renderer_ptr, surface_ptr.as<SDL_Surface>(), alpha_mode);
+				PF_LOG_INFO("Success: Texture created successfully.");
+			}
+			catch (const penguin::internal::error::InternalError& e) {
+				// Get the error code and message
+				std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+				std::string error_message = error_code_str + ": " + e.what();
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+
+			}
+			catch (const std::exception& e) { // Other specific C++ errors
+				// Get error message
+				std::string last_error_message = e.what();
+				std::string error_message = "Unknown_Error: " + last_error_message;
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+			}
+		}
+		else {
+			PF_LOG_ERROR("Texture_Creation_Failed: The renderer and/or the surface are either null or have not been initialized.");
+		}
+	}
+
+	Texture::Texture(NativeRendererPtr renderer_ptr, penguin::math::Vector2i size) : pimpl_(nullptr) {
+		// Log attempt to create a texture
+		PF_LOG_INFO("Attempting to create a streaming texture...");
+
+		if (renderer_ptr.ptr) {
+			try {
+				pimpl_ = std::make_unique<penguin::internal::rendering::primitives::TextureImpl>(renderer_ptr, size);
+				PF_LOG_INFO("Success: Texture created successfully.");
+			}
+			catch (const penguin::internal::error::InternalError& e) {
+				// Get the error code and message
+				std::string error_code_str = penguin::internal::error::error_code_to_string(e.get_error());
+				std::string error_message = error_code_str + ": " + e.what();
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+
+			}
+			catch (const std::exception& e) { // Other specific C++ errors
+				// Get error message
+				std::string last_error_message = e.what();
+				std::string error_message = "Unknown_Error: " + last_error_message;
+
+				// Log the error
+				PF_LOG_ERROR(error_message.c_str());
+			}
+		}
+		else {
+			PF_LOG_ERROR("Texture_Creation_Failed: The renderer is null or has not been initialized.");
+		}
+	}
+
 	Texture::~Texture() = default;
 
 	Texture::Texture(Texture&&) noexcept = default;
@@ -72,4 +136,13 @@ namespace penguin::rendering::primitives {
 		}
 		return pimpl_->size;
 	}
+
+	AlphaMode Texture::get_alpha_mode() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_alpha_mode() called on an uninitialized or destroyed texture.");
+			return AlphaMode::Straight;
+		}
+
+		return pimpl_->alpha_mode;
+	}
 }
@@ -1,5 +1,7 @@
 #include <penguin_framework/rendering/renderer.hpp>
 #include <rendering/internal/renderer_impl.hpp>
+#include <rendering/drawables/internal/number_renderer_impl.hpp>
+#include <rendering/drawables/internal/text_impl.hpp>
 #include <penguin_framework/logger/logger.hpp>
 
 namespace penguin::rendering {
@@ -278,14 +280,67 @@ namespace penguin::rendering {
 			return;
 		}
 
-		penguin::math::Vector2 position = txt.get_position();
-		bool res = pimpl_->draw_text(txt.get_native_ptr(), position.x, position.y);
+		if (!txt.is_valid()) {
+			PF_LOG_WARNING("draw_text() called with an uninitialized or destroyed text.");
+			return;
+		}
+
+		penguin::internal::rendering::drawables::TextImpl& impl = *txt.pimpl_; // non-const, the line breaks are computed lazily
+		bool res = false;
+
+		if (impl.baked) { // static text is a single textured quad, batched like any sprite
+			penguin::math::Rect2 region{ 0.0f, 0.0f, static_cast<float>(impl.baked->w), static_cast<float>(impl.baked->h) };
+			penguin::math::Rect2 placement{ impl.position.x, impl.position.y, region.size.x * impl.scale, region.size.y * impl.scale };
+
+			res = pimpl_->draw_sprite(NativeTexturePtr{ impl.baked.get() }, region, placement);
+		}
+		else if (impl.uses_paragraph_layout()) { // wrapped, aligned or spaced text is drawn line by line
+			res = impl.update_lines();
+
+			for (std::size_t i = 0; res && i < impl.line_layouts.size(); ++i) {
+				if (!impl.line_layouts[i]) {
+					continue; // empty line
+				}
+
+				const penguin::math::Rect2& bounds = impl.lines[i].bounds;
+				res = pimpl_->draw_text(NativeTextPtr{ impl.line_layouts[i]->text.get() }, impl.position.x + bounds.position.x * impl.scale,
+					impl.position.y + bounds.position.y * impl.scale, impl.colour, impl.scale);
+			}
+		}
+		else {
+			res = pimpl_->draw_text(NativeTextPtr{ impl.layout->text.get() }, impl.position.x, impl.position.y, impl.colour, impl.scale);
+		}
 
 		if (!res) {
 			PF_LOG_WARNING("Internal_System_Error: Failed to draw text to renderer.");
 		}
 	}
 
+	void Renderer::draw_number(const drawables::NumberRenderer& num) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("draw_number() called on an uninitialized or destroyed renderer.");
+			return;
+		}
+
+		if (!num.is_valid()) {
+			PF_LOG_WARNING("draw_number() called with an uninitialized or destroyed number renderer.");
+			return;
+		}
+
+		const penguin::internal::rendering::drawables::NumberRendererImpl& impl = *num.pimpl_;
+
+		if (impl.quad_count == 0) {
+			return; // nothing to draw
+		}
+
+		// The whole number is a single batch of quads from the glyph atlas
+		bool res = pimpl_->draw_geometry(NativeTexturePtr{ impl.atlas.get() }, impl.vertices.data(), impl.quad_count * 4, impl.indices.data(), impl.quad_count * 6);
+
+		if (!res) {
+			PF_LOG_WARNING("Internal_System_Error: Failed to draw number to renderer.");
+		}
+	}
+
 	NativeRendererPtr Renderer::get_native_ptr() const {
 		if (!is_valid()) {
 			PF_LOG_WARNING("get_native_ptr() called on an uninitialized or destroyed renderer.");
@@ -62,13 +62,236 @@ namespace penguin::rendering::systems {
 		return pimpl_->load_texture(path);
 	}
 
-	std::shared_ptr<primitives::Font> AssetManager::load_font(const char* path, float size, int outline) {
+	std::shared_ptr<primitives::Texture> AssetManager::load_texture(const char* path, penguin::math::Vector2i target_size) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load_texture() called on an uninitialized or destroyed asset manager.");
+			return nullptr;
+		}
+
+		return pimpl_->load_texture(path, target_size);
+	}
+
+	std::shared_ptr<primitives::Font> AssetManager::load_font(const char* path, float size, int outline, primitives::FontStyle style, const char* prewarm_charset) {
 		if (!is_valid()) {
 			PF_LOG_WARNING("load_font() called on an uninitialized or destroyed asset manager.");
 			return nullptr;
 		}
 
-		return pimpl_->load_font(path, size, outline);
+		return pimpl_->load_font(path, size, outline, style, prewarm_charset);
+	}
+
+	std::size_t AssetManager::preload(const PreloadManifest& manifest, const PreloadCallback& on_progress) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("preload() called on an uninitialized or destroyed asset manager.");
+			return 0;
+		}
+
+		return pimpl_->preload(manifest, on_progress);
+	}
+
+	// Interned handles
+
+	TextureHandle AssetManager::load_texture_handle(const char* path) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load_texture_handle() called on an uninitialized or destroyed asset manager.");
+			return {};
+		}
+
+		return pimpl_->load_texture_handle(path);
+	}
+
+	FontHandle AssetManager::load_font_handle(const char* path, float size, int outline, primitives::FontStyle style) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load_font_handle() called on an uninitialized or destroyed asset manager.");
+			return {};
+		}
+
+		return pimpl_->load_font_handle(path, size, outline, style);
+	}
+
+	TextureHandle AssetManager::find_texture_handle(AssetId id) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("find_texture_handle() called on an uninitialized or destroyed asset manager.");
+			return {};
+		}
+
+		return pimpl_->find_texture_handle(id);
+	}
+
+	FontHandle AssetManager::find_font_handle(AssetId id, float size, int outline, primitives::FontStyle style) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("find_font_handle() called on an uninitialized or destroyed asset manager.");
+			return {};
+		}
+
+		return pimpl_->find_font_handle(id, size, outline, style);
+	}
+
+	const std::shared_ptr<primitives::Texture>& AssetManager::get_texture(TextureHandle handle) const {
+		static const std::shared_ptr<primitives::Texture> no_texture;
+
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_texture() called on an uninitialized or destroyed asset manager.");
+			return no_texture;
+		}
+
+		return pimpl_->get_texture(handle);
+	}
+
+	const std::shared_ptr<primitives::Font>& AssetManager::get_font(FontHandle handle) const {
+		static const std::shared_ptr<primitives::Font> no_font;
+
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_font() called on an uninitialized or destroyed asset manager.");
+			return no_font;
+		}
+
+		return pimpl_->get_font(handle);
+	}
+
+	// Asynchronous loading
+
+	std::shared_future<std::shared_ptr<primitives::Texture>> AssetManager::load_texture_async(const char* path) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load_texture_async() called on an uninitialized or destroyed asset manager.");
+
+			std::promise<std::shared_ptr<primitives::Texture>> failed;
+			failed.set_value(nullptr);
+			return failed.get_future().share();
+		}
+
+		return pimpl_->load_texture_async(path);
+	}
+
+	std::shared_future<std::shared_ptr<primitives::Font>> AssetManager::load_font_async(const char* path, float size, int outline, primitives::FontStyle style) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load_font_async() called on an uninitialized or destroyed asset manager.");
+
+			std::promise<std::shared_ptr<primitives::Font>> failed;
+			failed.set_value(nullptr);
+			return failed.get_future().share();
+		}
+
+		return pimpl_->load_font_async(path, size, outline, style);
+	}
+
+	std::size_t AssetManager::process_uploads(float budget_ms) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("process_uploads() called on an uninitialized or destroyed asset manager.");
+			return 0;
+		}
+
+		return pimpl_->process_uploads(budget_ms);
+	}
+
+	std::size_t AssetManager::get_pending_uploads() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_pending_uploads() called on an uninitialized or destroyed asset manager.");
+			return 0;
+		}
+
+		return pimpl_->get_pending_uploads();
+	}
+
+	// Packed archives
+
+	bool AssetManager::mount_archive(const char* archive_path, const char* mount_point) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("mount_archive() called on an uninitialized or destroyed asset manager.");
+			return false;
+		}
+
+		if (!pimpl_->mount_archive(archive_path, mount_point)) {
+			std::string error_message = std::string("Internal_System_Error: Failed to mount the asset archive ") + (archive_path ? archive_path : "(null)") + ".";
+			PF_LOG_WARNING(error_message.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	// Probing
+
+	TextureInfo AssetManager::probe_texture(const char* path) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("probe_texture() called on an uninitialized or destroyed asset manager.");
+			return {};
+		}
+
+		return pimpl_->probe_texture(path);
+	}
+
+	// Disk cache
+
+	bool AssetManager::set_texture_disk_cache(const char* directory) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_texture_disk_cache() called on an uninitialized or destroyed asset manager.");
+			return false;
+		}
+
+		if (!pimpl_->disk_cache.set_directory(directory ? directory : "")) {
+			std::string error_message = std::string("Internal_System_Error: Failed to create the texture disk cache directory ") + directory + ".";
+			PF_LOG_WARNING(error_message.c_str());
+			return false;
+		}
+
+		return true;
 	}
-}
 
+	void AssetManager::set_texture_alpha_mode(primitives::AlphaMode mode) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_texture_alpha_mode() called on an uninitialized or destroyed asset manager.");
+			return;
+		}
+
+		pimpl_->texture_loader.set_alpha_mode(mode);
+	}
+
+	// Memory budgets
+
+	void AssetManager::set_texture_memory_budget(std::size_t bytes) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_texture_memory_budget() called on an uninitialized or destroyed asset manager.");
+			return;
+		}
+
+		pimpl_->texture_loader.set_memory_budget(bytes);
+	}
+
+	void AssetManager::set_font_memory_budget(std::size_t bytes) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_font_memory_budget() called on an uninitialized or destroyed asset manager.");
+			return;
+		}
+
+		pimpl_->font_loader.set_memory_budget(bytes);
+	}
+
+	void AssetManager::trim() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("trim() called on an uninitialized or destroyed asset manager.");
+			return;
+		}
+
+		pimpl_->texture_loader.trim();
+		pimpl_->font_loader.trim();
+	}
+
+	CacheStats AssetManager::get_texture_stats() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_texture_stats() called on an uninitialized or destroyed asset manager.");
+			return CacheStats{};
+		}
+
+		return pimpl_->texture_loader.get_stats();
+	}
+
+	CacheStats AssetManager::get_font_stats() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_font_stats() called on an uninitialized or destroyed asset manager.");
+			return CacheStats{};
+		}
+
+		return pimpl_->font_loader.get_stats();
+	}
+}
@@ -47,12 +47,69 @@ namespace penguin::rendering::systems {
 		return is_valid();
 	}
 
-	std::shared_ptr<penguin::rendering::primitives::Font> FontLoader::load(const char* path, float size, int outline) {
+	std::shared_ptr<penguin::rendering::primitives::Font> FontLoader::load(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style) {
 		if (!is_valid()) {
 			PF_LOG_WARNING("load() called on an uninitialized or destroyed font loader.");
 			return nullptr;
 		}
 
-		return pimpl_->load(path, size, outline);
+		return pimpl_->load(path, size, outline, style);
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Font> FontLoader::load(const char* path, std::shared_ptr<const std::vector<unsigned char>> font_data, float size, int outline,
+		penguin::rendering::primitives::FontStyle style) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load() called on an uninitialized or destroyed font loader.");
+			return nullptr;
+		}
+
+		return pimpl_->load(path, size, outline, style, std::move(font_data));
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Font> FontLoader::find(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("find() called on an uninitialized or destroyed font loader.");
+			return nullptr;
+		}
+
+		return pimpl_->find(path, size, outline, style);
+	}
+
+	// Memory budget
+
+	void FontLoader::set_memory_budget(std::size_t bytes) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_memory_budget() called on an uninitialized or destroyed font loader.");
+			return;
+		}
+
+		pimpl_->font_cache.set_budget(bytes);
+	}
+
+	std::size_t FontLoader::get_memory_budget() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_memory_budget() called on an uninitialized or destroyed font loader.");
+			return 0;
+		}
+
+		return pimpl_->font_cache.get_budget();
+	}
+
+	void FontLoader::trim() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("trim() called on an uninitialized or destroyed font loader.");
+			return;
+		}
+
+		pimpl_->font_cache.evict_unused();
+	}
+
+	CacheStats FontLoader::get_stats() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_stats() called on an uninitialized or destroyed font loader.");
+			return CacheStats{};
+		}
+
+		return pimpl_->font_cache.get_stats();
 	}
 }
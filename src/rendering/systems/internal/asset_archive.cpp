@@ -0,0 +1,259 @@
+#include <rendering/systems/internal/asset_archive.hpp>
+#include <penguin_framework/rendering/systems/asset_handle.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace penguin::internal::rendering::systems {
+
+	namespace {
+		std::uint32_t read_u32(const unsigned char* bytes) {
+			return static_cast<std::uint32_t>(bytes[0])
+				| (static_cast<std::uint32_t>(bytes[1]) << 8)
+				| (static_cast<std::uint32_t>(bytes[2]) << 16)
+				| (static_cast<std::uint32_t>(bytes[3]) << 24);
+		}
+
+		std::uint64_t read_u64(const unsigned char* bytes) {
+			return static_cast<std::uint64_t>(read_u32(bytes)) | (static_cast<std::uint64_t>(read_u32(bytes + 4)) << 32);
+		}
+
+		void write_u32(std::vector<unsigned char>& out, std::uint32_t value) {
+			for (int i = 0; i < 4; ++i) {
+				out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+			}
+		}
+
+		void write_u64(std::vector<unsigned char>& out, std::uint64_t value) {
+			write_u32(out, static_cast<std::uint32_t>(value));
+			write_u32(out, static_cast<std::uint32_t>(value >> 32));
+		}
+
+		std::size_t align_up(std::size_t value, std::size_t alignment) {
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		// Index record field offsets
+		constexpr std::size_t Hash_Field = 0;
+		constexpr std::size_t Offset_Field = 8;
+		constexpr std::size_t Stored_Size_Field = 16;
+		constexpr std::size_t Path_Offset_Field = 32;
+		constexpr std::size_t Path_Length_Field = 36;
+		constexpr std::size_t Flags_Field = 40;
+	}
+
+	std::string normalize_archive_path(std::string_view path) {
+		std::string normalized(path);
+		std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+		std::size_t start = 0;
+		while (true) {
+			if (normalized.compare(start, 2, "./") == 0) {
+				start += 2;
+			}
+			else if (start < normalized.size() && normalized[start] == '/') {
+				++start;
+			}
+			else {
+				break;
+			}
+		}
+
+		return normalized.substr(start);
+	}
+
+	std::uint64_t hash_archive_path(std::string_view path) {
+		return penguin::rendering::systems::hash_asset_path(path); // same hash as AssetId, so ids can be checked against an archive's index
+	}
+
+	// Reader
+
+	bool AssetArchive::open(const char* path) {
+		entry_count = 0;
+		index = nullptr;
+		strings = nullptr;
+		strings_size = 0;
+
+		if (!file.open(path)) {
+			return false;
+		}
+
+		const unsigned char* data = file.get_data();
+		const std::size_t size = file.get_size();
+
+		if (size < Header_Size || std::memcmp(data, Magic, sizeof(Magic)) != 0 || read_u32(data + 4) != Version) {
+			file.close();
+			return false;
+		}
+
+		const std::uint32_t count = read_u32(data + 8);
+		const std::size_t index_end = Header_Size + static_cast<std::size_t>(count) * Index_Entry_Size;
+
+		if (index_end > size) {
+			file.close();
+			return false;
+		}
+
+		// The string table runs from the end of the index up to the first blob
+		std::size_t strings_end = index_end;
+		for (std::uint32_t i = 0; i < count; ++i) {
+			const unsigned char* record = data + Header_Size + static_cast<std::size_t>(i) * Index_Entry_Size;
+			std::size_t path_end = static_cast<std::size_t>(read_u32(record + Path_Offset_Field)) + read_u32(record + Path_Length_Field);
+			strings_end = std::max(strings_end, index_end + path_end);
+
+			// Compared without adding them, so a crafted offset + size cannot wrap around and pass
+			const std::uint64_t blob_offset = read_u64(record + Offset_Field);
+			const std::uint64_t blob_size = read_u64(record + Stored_Size_Field);
+			if (blob_offset > size || blob_size > size - blob_offset) {
+				file.close();
+				return false;
+			}
+		}
+
+		if (strings_end > size) {
+			file.close();
+			return false;
+		}
+
+		entry_count = count;
+		index = data + Header_Size;
+		strings = data + index_end;
+		strings_size = strings_end - index_end;
+
+		return true;
+	}
+
+	ArchiveBlob AssetArchive::find(std::string_view path) const {
+		if (!index) {
+			return {};
+		}
+
+		const std::uint64_t hash = hash_archive_path(path);
+
+		// Lower bound on the hash, then walk the (rare) collisions
+		std::size_t low = 0;
+		std::size_t high = entry_count;
+
+		while (low < high) {
+			std::size_t mid = low + (high - low) / 2;
+
+			if (read_u64(index + mid * Index_Entry_Size + Hash_Field) < hash) {
+				low = mid + 1;
+			}
+			else {
+				high = mid;
+			}
+		}
+
+		for (std::size_t i = low; i < entry_count; ++i) {
+			const unsigned char* record = index + i * Index_Entry_Size;
+
+			if (read_u64(record + Hash_Field) != hash) {
+				break;
+			}
+
+			if (get_path(i) != path) {
+				continue;
+			}
+
+			if (read_u32(record + Flags_Field) & Entry_Lz4) {
+				return {}; // compressed blobs cannot be decoded by this build
+			}
+
+			return ArchiveBlob{ file.get_data() + read_u64(record + Offset_Field), static_cast<std::size_t>(read_u64(record + Stored_Size_Field)) };
+		}
+
+		return {};
+	}
+
+	std::string_view AssetArchive::get_path(std::size_t i) const {
+		const unsigned char* record = index + i * Index_Entry_Size;
+		return std::string_view(reinterpret_cast<const char*>(strings) + read_u32(record + Path_Offset_Field), read_u32(record + Path_Length_Field));
+	}
+
+	// Writer
+
+	void AssetArchiveWriter::add(std::string_view path, std::vector<unsigned char> data) {
+		std::string normalized = normalize_archive_path(path);
+
+		auto it = std::find_if(entries.begin(), entries.end(), [&normalized](const Entry& entry) { return entry.path == normalized; });
+		if (it != entries.end()) {
+			it->data = std::move(data);
+			return;
+		}
+
+		std::uint64_t hash = hash_archive_path(normalized);
+		entries.push_back(Entry{ std::move(normalized), hash, std::move(data) });
+	}
+
+	bool AssetArchiveWriter::write(const char* path) const {
+		std::vector<const Entry*> sorted;
+		sorted.reserve(entries.size());
+		for (const Entry& entry : entries) {
+			sorted.push_back(&entry);
+		}
+
+		std::sort(sorted.begin(), sorted.end(), [](const Entry* a, const Entry* b) {
+			return a->hash != b->hash ? a->hash < b->hash : a->path < b->path;
+		});
+
+		// Lay out the string table and the blobs
+		const std::size_t index_end = AssetArchive::Header_Size + sorted.size() * AssetArchive::Index_Entry_Size;
+
+		std::vector<std::uint32_t> path_offsets;
+		std::size_t strings_size = 0;
+		for (const Entry* entry : sorted) {
+			path_offsets.push_back(static_cast<std::uint32_t>(strings_size));
+			strings_size += entry->path.size();
+		}
+
+		std::vector<std::uint64_t> blob_offsets;
+		std::size_t blob_offset = align_up(index_end + strings_size, AssetArchive::Blob_Alignment);
+		for (const Entry* entry : sorted) {
+			blob_offsets.push_back(blob_offset);
+			blob_offset = align_up(blob_offset + entry->data.size(), AssetArchive::Blob_Alignment);
+		}
+
+		std::vector<unsigned char> out;
+		out.reserve(blob_offset);
+
+		// Header
+		out.insert(out.end(), AssetArchive::Magic, AssetArchive::Magic + sizeof(AssetArchive::Magic));
+		write_u32(out, AssetArchive::Version);
+		write_u32(out, static_cast<std::uint32_t>(sorted.size()));
+		write_u32(out, 0);
+
+		// Index
+		for (std::size_t i = 0; i < sorted.size(); ++i) {
+			write_u64(out, sorted[i]->hash);
+			write_u64(out, blob_offsets[i]);
+			write_u64(out, sorted[i]->data.size());
+			write_u64(out, sorted[i]->data.size()); // stored uncompressed
+			write_u32(out, path_offsets[i]);
+			write_u32(out, static_cast<std::uint32_t>(sorted[i]->path.size()));
+			write_u32(out, 0);
+			write_u32(out, 0);
+		}
+
+		// Strings
+		for (const Entry* entry : sorted) {
+			out.insert(out.end(), entry->path.begin(), entry->path.end());
+		}
+
+		// Blobs
+		for (std::size_t i = 0; i < sorted.size(); ++i) {
+			out.resize(blob_offsets[i], 0); // alignment padding
+			out.insert(out.end(), sorted[i]->data.begin(), sorted[i]->data.end());
+		}
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+
+		return static_cast<bool>(file);
+	}
+}
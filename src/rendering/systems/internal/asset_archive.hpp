@@ -0,0 +1,85 @@
+#pragma once
+
+#include <rendering/systems/internal/mapped_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace penguin::internal::rendering::systems {
+
+	// Packed asset archive (.pfpk), all integers little endian:
+	//
+	//   header   magic "PFPK", u32 version, u32 entry count, u32 flags (unused)
+	//   index    one record per entry, sorted by (path hash, path):
+	//            u64 path hash, u64 data offset, u64 stored size, u64 original size,
+	//            u32 path offset, u32 path length, u32 entry flags, u32 reserved
+	//   strings  the entry paths, referenced by the index
+	//   blobs    the file contents, each starting on a 16 byte boundary
+	//
+	// Paths are relative, use '/' as the separator and are hashed with 64-bit FNV-1a.
+
+	struct ArchiveBlob {
+		const unsigned char* data = nullptr;
+		std::size_t size = 0;
+
+		explicit operator bool() const { return data != nullptr; }
+	};
+
+	class AssetArchive {
+	public:
+		static constexpr char Magic[4] = { 'P', 'F', 'P', 'K' };
+		static constexpr std::uint32_t Version = 1;
+		static constexpr std::size_t Header_Size = 16;
+		static constexpr std::size_t Index_Entry_Size = 48;
+		static constexpr std::size_t Blob_Alignment = 16;
+		static constexpr std::uint32_t Entry_Lz4 = 0x01; // reserved for LZ4 compressed blobs, which this build does not decode
+
+		AssetArchive() = default;
+
+		// Copy & move (including assigment) not allowed
+
+		AssetArchive(const AssetArchive&) = delete;
+		AssetArchive& operator=(const AssetArchive&) = delete;
+		AssetArchive(AssetArchive&&) noexcept = delete;
+		AssetArchive& operator=(AssetArchive&&) noexcept = delete;
+
+		bool open(const char* path); // maps the archive and validates its header and index
+		bool is_open() const { return file.is_open(); }
+
+		ArchiveBlob find(std::string_view path) const; // binary search on the path hash, an empty blob if missing
+		std::size_t get_entry_count() const { return entry_count; }
+
+	private:
+		std::string_view get_path(std::size_t index) const;
+
+		MappedFile file;
+		std::uint32_t entry_count = 0;
+		const unsigned char* index = nullptr;
+		const unsigned char* strings = nullptr;
+		std::size_t strings_size = 0;
+	};
+
+	// Builds an archive in memory and writes it out in one go
+	class AssetArchiveWriter {
+	public:
+		void add(std::string_view path, std::vector<unsigned char> data); // replaces an entry with the same path
+		bool write(const char* path) const;
+
+		std::size_t get_entry_count() const { return entries.size(); }
+
+	private:
+		struct Entry {
+			std::string path;
+			std::uint64_t hash;
+			std::vector<unsigned char> data;
+		};
+
+		std::vector<Entry> entries;
+	};
+
+	std::string normalize_archive_path(std::string_view path); // '/' separators, no leading "./" or '/'
+	std::uint64_t hash_archive_path(std::string_view path);
+}
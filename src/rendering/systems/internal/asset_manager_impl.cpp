@@ -1,4 +1,12 @@
 #include <rendering/systems/internal/asset_manager_impl.hpp>
+#include <rendering/systems/internal/image_probe.hpp>
+#include <rendering/internal/native_format.hpp>
+
+#include <SDL3_image/SDL_image.h>
+
+#include <chrono>
+#include <limits>
+#include <thread>
 
 namespace penguin::internal::rendering::systems {
 
@@ -8,11 +16,26 @@ namespace penguin::internal::rendering::systems {
 			"Failed to initialize the asset manager.",
 			penguin::internal::error::ErrorCode::Asset_Manager_Init_Failed
 		);
+
+		native_format = get_native_texture_format(renderer_ptr.as<SDL_Renderer>());
+	}
+
+	AssetManagerImpl::~AssetManagerImpl() {
+		workers.shutdown(); // queued loads are dropped, their futures report a broken promise
+
+		// Loads that finished decoding but were never uploaded resolve to nullptr
+		for (PendingTexture& pending : texture_uploads) {
+			pending.promise->set_value(nullptr);
+		}
+		for (PendingFont& pending : font_uploads) {
+			pending.promise->set_value(nullptr);
+		}
 	}
 
 	std::shared_ptr<penguin::rendering::primitives::Texture> AssetManagerImpl::load_texture(const char* path) {
-		if (!std::filesystem::exists(path)) {
-			return nullptr; // Return nullptr as path doesn't exist
+		// Only valid images are ever cached, so a hit skips the extension and file system checks
+		if (std::shared_ptr<penguin::rendering::primitives::Texture> cached = texture_loader.find(path)) {
+			return cached;
 		}
 
 		// Check if file extension ends with the supported images: PNG, JPEG, BMP, GIF and SVG
@@ -20,20 +43,482 @@ namespace penguin::internal::rendering::systems {
 			return nullptr; // file image not supported
 		}
 
-		return texture_loader.load(renderer_ptr, path); // valid path, get the Texture
-	}
+		ArchiveBlob blob = find_in_archives(path);
 
-	std::shared_ptr<penguin::rendering::primitives::Font> AssetManagerImpl::load_font(const char* path, float size, int outline) {
-		if (!std::filesystem::exists(path)) {
+		if (!blob && !std::filesystem::exists(path)) {
 			return nullptr; // Return nullptr as path doesn't exist
 		}
 
-		// Check if file extension ends with the supported images: TTF and OTF
-		if (!has_valid_font_ext(std::filesystem::path(path))) {
-			return nullptr; // file image not supported
+		if (!blob && !disk_cache.is_enabled()) {
+			return texture_loader.load(renderer_ptr, path); // valid path, get the Texture
+		}
+
+		std::uint64_t content_hash = 0;
+		std::unique_ptr<SDL_Surface, void(*)(SDL_Surface*)> surface(decode_image(path, blob, content_hash), &SDL_DestroySurface);
+		if (!surface) {
+			return nullptr;
+		}
+
+		return texture_loader.load(renderer_ptr, path, NativeSurfacePtr{ surface.get() }, content_hash);
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Texture> AssetManagerImpl::load_texture(const char* path, penguin::math::Vector2i target_size) {
+		if (target_size.x <= 0 || target_size.y <= 0 || !has_svg_ext(std::filesystem::path(path))) {
+			return load_texture(path); // raster images (and SVGs without a size) load at their own size
+		}
+
+		const penguin::math::Vector2i bucket(get_svg_size_bucket(target_size.x), get_svg_size_bucket(target_size.y));
+
+		// Each bucket is cached under its own key, so finding it again never touches the SVG
+		const std::string key = std::string(path) + "@" + std::to_string(bucket.x) + "x" + std::to_string(bucket.y);
+		if (std::shared_ptr<penguin::rendering::primitives::Texture> cached = texture_loader.find(key.c_str())) {
+			return cached;
+		}
+
+		FileData file;
+		ArchiveBlob blob = find_in_archives(path);
+
+		if (!blob) {
+			file = read_file(path);
+			if (!file) {
+				return nullptr; // Return nullptr as path doesn't exist
+			}
+
+			blob = ArchiveBlob{ file->data(), file->size() };
+		}
+
+		SDL_IOStream* stream = SDL_IOFromConstMem(blob.data, blob.size);
+		std::unique_ptr<SDL_Surface, void(*)(SDL_Surface*)> surface(stream ? IMG_LoadSizedSVG_IO(stream, bucket.x, bucket.y) : nullptr, &SDL_DestroySurface);
+		if (stream) {
+			SDL_CloseIO(stream); // IMG_LoadSizedSVG_IO() leaves the stream open
+		}
+
+		if (!surface) {
+			return nullptr;
+		}
+
+		// The size is part of the contents, so each bucket is its own texture while identical SVGs still share theirs
+		const std::int32_t size[2] = { bucket.x, bucket.y };
+		const std::uint64_t content_hash = hash_data(blob.data, blob.size) ^ hash_data(reinterpret_cast<const unsigned char*>(size), sizeof(size));
+
+		return texture_loader.load(renderer_ptr, key.c_str(), NativeSurfacePtr{ surface.get() }, content_hash);
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Font> AssetManagerImpl::load_font(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style,
+		const char* prewarm_charset) {
+		std::shared_ptr<penguin::rendering::primitives::Font> font = font_loader.find(path, size, outline, style); // a hit skips the checks below
+
+		if (!font) {
+			// Check if file extension ends with the supported images: TTF and OTF
+			if (!has_valid_font_ext(std::filesystem::path(path))) {
+				return nullptr; // file image not supported
+			}
+
+			if (ArchiveBlob blob = find_in_archives(path)) {
+				font = font_loader.load(path, std::make_shared<const std::vector<unsigned char>>(blob.data, blob.data + blob.size), size, outline, style);
+			}
+			else if (std::filesystem::exists(path)) {
+				font = font_loader.load(path, size, outline, style); // valid path, get the Font
+			}
+			else {
+				return nullptr; // Return nullptr as path doesn't exist
+			}
+		}
+
+		if (font && prewarm_charset) {
+			font->prewarm(prewarm_charset); // glyphs already in the cache are cheap to revisit
+		}
+
+		return font;
+	}
+
+	std::shared_future<std::shared_ptr<penguin::rendering::primitives::Texture>> AssetManagerImpl::load_texture_async(const char* path) {
+		using TexturePtr = std::shared_ptr<penguin::rendering::primitives::Texture>;
+
+		auto promise = std::make_shared<std::promise<TexturePtr>>();
+
+		if (!has_valid_image_ext(std::filesystem::path(path)) || (!find_in_archives(path) && !std::filesystem::exists(path))) {
+			promise->set_value(nullptr); // same checks as load_texture(), resolved right away
+			return promise->get_future().share();
+		}
+
+		if (TexturePtr cached = texture_loader.find(path)) {
+			promise->set_value(std::move(cached));
+			return promise->get_future().share();
+		}
+
+		std::string path_str(path);
+		std::shared_future<TexturePtr> future;
+
+		{
+			std::lock_guard<std::mutex> lock(upload_mutex);
+
+			auto it = texture_requests.find(path_str);
+			if (it != texture_requests.end()) {
+				return it->second; // already decoding, share that load
+			}
+
+			future = promise->get_future().share();
+			texture_requests.emplace(path_str, future);
+		}
+
+		workers.submit([this, path_str = std::move(path_str), promise]() mutable {
+			std::uint64_t content_hash = 0;
+			SDL_Surface* surface = decode_image(path_str, find_in_archives(path_str.c_str()), content_hash); // decoding does not touch the renderer
+			PendingTexture pending{ std::move(path_str), { surface, &SDL_DestroySurface }, content_hash, std::move(promise) };
+
+			if (!surface) {
+				resolve(pending, nullptr);
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(upload_mutex);
+			texture_uploads.push_back(std::move(pending));
+		});
+
+		return future;
+	}
+
+	std::shared_future<std::shared_ptr<penguin::rendering::primitives::Font>> AssetManagerImpl::load_font_async(const char* path, float size, int outline,
+		penguin::rendering::primitives::FontStyle style) {
+		using FontPtr = std::shared_ptr<penguin::rendering::primitives::Font>;
+
+		auto promise = std::make_shared<std::promise<FontPtr>>();
+
+		if (!has_valid_font_ext(std::filesystem::path(path)) || (!find_in_archives(path) && !std::filesystem::exists(path))) {
+			promise->set_value(nullptr); // same checks as load_font(), resolved right away
+			return promise->get_future().share();
+		}
+
+		if (FontPtr cached = font_loader.find(path, size, outline, style)) {
+			promise->set_value(std::move(cached));
+			return promise->get_future().share();
+		}
+
+		FontKey key{ std::string(path), size, outline, style };
+		std::shared_future<FontPtr> future;
+
+		{
+			std::lock_guard<std::mutex> lock(upload_mutex);
+
+			auto it = font_requests.find(key);
+			if (it != font_requests.end()) {
+				return it->second; // already reading, share that load
+			}
+
+			future = promise->get_future().share();
+			font_requests.emplace(key, future);
+		}
+
+		workers.submit([this, key = std::move(key), promise]() mutable {
+			// The disk read is the slow part, opening the font from memory is cheap
+			ArchiveBlob blob = find_in_archives(key.path.c_str());
+			FileData data = blob ? std::make_shared<const std::vector<unsigned char>>(blob.data, blob.data + blob.size) : read_file(key.path);
+			PendingFont pending{ std::move(key.path), key.size, key.outline, key.style, std::move(data), std::move(promise) };
+
+			if (!pending.data) {
+				resolve(pending, nullptr); // an unreadable file never reaches the render thread, which would read it again
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(upload_mutex);
+			font_uploads.push_back(std::move(pending));
+		});
+
+		return future;
+	}
+
+	std::size_t AssetManagerImpl::process_uploads(float budget_ms) {
+		using clock = std::chrono::steady_clock;
+
+		const clock::time_point deadline = clock::now() + std::chrono::duration_cast<clock::duration>(std::chrono::duration<float, std::milli>(budget_ms));
+		std::size_t processed = 0;
+
+		// Always upload at least one asset, so loading makes progress even with a tiny budget
+		do {
+			if (!upload_next()) {
+				break;
+			}
+
+			++processed;
+		} while (clock::now() < deadline);
+
+		return processed;
+	}
+
+	std::size_t AssetManagerImpl::get_pending_uploads() {
+		std::lock_guard<std::mutex> lock(upload_mutex);
+		return texture_uploads.size() + font_uploads.size();
+	}
+
+	std::size_t AssetManagerImpl::preload(const penguin::rendering::systems::PreloadManifest& manifest, const penguin::rendering::systems::PreloadCallback& on_progress) {
+		// Everything is queued up front, so the workers decode in parallel while this thread uploads
+		std::vector<std::shared_future<std::shared_ptr<penguin::rendering::primitives::Texture>>> textures;
+		std::vector<std::shared_future<std::shared_ptr<penguin::rendering::primitives::Font>>> fonts;
+		textures.reserve(manifest.textures.size());
+		fonts.reserve(manifest.fonts.size());
+
+		for (const std::string& path : manifest.textures) {
+			textures.push_back(load_texture_async(path.c_str()));
+		}
+		for (const penguin::rendering::systems::FontPreload& font : manifest.fonts) {
+			fonts.push_back(load_font_async(font.path.c_str(), font.size, font.outline, font.style));
+		}
+
+		penguin::rendering::systems::PreloadProgress progress{ 0, 0, textures.size() + fonts.size() };
+
+		// Removes the requests that resolved, counting them. Returns false if none did.
+		auto collect = [&progress, &on_progress](auto& futures) {
+			bool any_ready = false;
+
+			for (std::size_t i = 0; i < futures.size();) {
+				if (futures[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+					++i;
+					continue;
+				}
+
+				futures[i].get() ? ++progress.loaded : ++progress.failed;
+				futures[i] = std::move(futures.back()); // order does not matter, swap and pop
+				futures.pop_back();
+				any_ready = true;
+
+				if (on_progress) {
+					on_progress(progress);
+				}
+			}
+
+			return any_ready;
+		};
+
+		while (!textures.empty() || !fonts.empty()) {
+			upload_next();
+
+			const bool textures_ready = collect(textures);
+			const bool fonts_ready = collect(fonts);
+
+			if (!textures_ready && !fonts_ready && get_pending_uploads() == 0) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1)); // the workers are still decoding
+			}
+		}
+
+		return progress.loaded;
+	}
+
+	bool AssetManagerImpl::upload_next() {
+		std::unique_lock<std::mutex> lock(upload_mutex);
+
+		if (!texture_uploads.empty()) {
+			PendingTexture pending = std::move(texture_uploads.front());
+			texture_uploads.pop_front();
+			lock.unlock(); // workers can keep queueing while the texture is created
+
+			std::shared_ptr<penguin::rendering::primitives::Texture> texture = texture_loader.load(renderer_ptr, pending.path.c_str(), NativeSurfacePtr{ pending.surface.get() }, pending.content_hash);
+			resolve(pending, texture && texture->is_valid() ? std::move(texture) : nullptr);
+
+			return true;
+		}
+
+		if (!font_uploads.empty()) {
+			PendingFont pending = std::move(font_uploads.front());
+			font_uploads.pop_front();
+			lock.unlock();
+
+			std::shared_ptr<penguin::rendering::primitives::Font> font = font_loader.load(pending.path.c_str(), std::move(pending.data), pending.size, pending.outline, pending.style);
+			resolve(pending, font && font->is_valid() ? std::move(font) : nullptr);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	// Interned handles
+
+	penguin::rendering::systems::TextureHandle AssetManagerImpl::load_texture_handle(const char* path) {
+		const std::uint64_t hash = penguin::rendering::systems::hash_asset_path(path);
+
+		auto it = texture_handle_ids.find(hash);
+		if (it != texture_handle_ids.end()) {
+			// Two paths with the same hash cannot both be interned, the later one gets an invalid handle
+			return texture_handle_paths[it->second] == path ? penguin::rendering::systems::TextureHandle{ it->second } : penguin::rendering::systems::TextureHandle{};
+		}
+
+		std::shared_ptr<penguin::rendering::primitives::Texture> texture = load_texture(path);
+		if (!texture || !texture->is_valid()) {
+			return {}; // not interned, so a later call can retry
+		}
+
+		const auto index = static_cast<std::uint32_t>(texture_handles.size());
+		texture_handles.push_back(std::move(texture));
+		texture_handle_paths.emplace_back(path);
+		texture_handle_ids.emplace(hash, index);
+
+		return penguin::rendering::systems::TextureHandle{ index };
+	}
+
+	penguin::rendering::systems::FontHandle AssetManagerImpl::load_font_handle(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style) {
+		const FontHandleKey key{ penguin::rendering::systems::hash_asset_path(path), size, outline, style };
+
+		auto it = font_handle_ids.find(key);
+		if (it != font_handle_ids.end()) {
+			return font_handle_paths[it->second] == path ? penguin::rendering::systems::FontHandle{ it->second } : penguin::rendering::systems::FontHandle{};
+		}
+
+		std::shared_ptr<penguin::rendering::primitives::Font> font = load_font(path, size, outline, style);
+		if (!font || !font->is_valid()) {
+			return {};
+		}
+
+		const auto index = static_cast<std::uint32_t>(font_handles.size());
+		font_handles.push_back(std::move(font));
+		font_handle_paths.emplace_back(path);
+		font_handle_ids.emplace(key, index);
+
+		return penguin::rendering::systems::FontHandle{ index };
+	}
+
+	penguin::rendering::systems::TextureHandle AssetManagerImpl::find_texture_handle(penguin::rendering::systems::AssetId id) const {
+		auto it = texture_handle_ids.find(id.hash);
+		return it != texture_handle_ids.end() ? penguin::rendering::systems::TextureHandle{ it->second } : penguin::rendering::systems::TextureHandle{};
+	}
+
+	penguin::rendering::systems::FontHandle AssetManagerImpl::find_font_handle(penguin::rendering::systems::AssetId id, float size, int outline,
+		penguin::rendering::primitives::FontStyle style) const {
+		auto it = font_handle_ids.find(FontHandleKey{ id.hash, size, outline, style });
+		return it != font_handle_ids.end() ? penguin::rendering::systems::FontHandle{ it->second } : penguin::rendering::systems::FontHandle{};
+	}
+
+	std::size_t FontHandleKeyHash::operator()(const FontHandleKey& key) const {
+		std::size_t seed = static_cast<std::size_t>(key.path_hash);
+
+		auto combine = [&seed](std::size_t value) {
+			seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+		};
+
+		combine(std::hash<float>{}(key.size));
+		combine(std::hash<int>{}(key.outline));
+		combine(std::hash<uint32_t>{}(static_cast<uint32_t>(key.style)));
+
+		return seed;
+	}
+
+	bool AssetManagerImpl::mount_archive(const char* path, const char* mount_point) {
+		if (!path) {
+			return false;
+		}
+
+		auto archive = std::make_unique<AssetArchive>();
+		if (!archive->open(path)) {
+			return false;
+		}
+
+		std::string prefix = normalize_archive_path(mount_point ? mount_point : "");
+		while (!prefix.empty() && prefix.back() == '/') {
+			prefix.pop_back();
+		}
+
+		std::unique_lock<std::shared_mutex> lock(archive_mutex);
+		archives.push_back(MountedArchive{ std::move(archive), std::move(prefix) });
+
+		return true;
+	}
+
+	penguin::rendering::systems::TextureInfo AssetManagerImpl::probe_texture(const char* path) {
+		if (!path) {
+			return {};
+		}
+
+		if (ArchiveBlob blob = find_in_archives(path)) {
+			return probe_image(blob.data, blob.size);
+		}
+
+		return probe_image(path); // reads the header only, not the whole file
+	}
+
+	ArchiveBlob AssetManagerImpl::find_in_archives(const char* path) {
+		std::shared_lock<std::shared_mutex> lock(archive_mutex);
+
+		if (archives.empty()) {
+			return {};
+		}
+
+		const std::string normalized = normalize_archive_path(path);
+		const std::string_view full(normalized);
+
+		// Newest mount first, so patches and mods can override the base archives
+		for (auto it = archives.rbegin(); it != archives.rend(); ++it) {
+			std::string_view relative = full;
+
+			if (!it->mount_point.empty()) {
+				if (!relative.starts_with(it->mount_point) || relative.size() <= it->mount_point.size() || relative[it->mount_point.size()] != '/') {
+					continue; // not under this mount point
+				}
+
+				relative.remove_prefix(it->mount_point.size() + 1);
+			}
+
+			if (ArchiveBlob blob = it->archive->find(relative)) {
+				return blob;
+			}
 		}
 
-		return font_loader.load(path, size, outline); // valid path, get the Font
+		return {};
+	}
+
+	SDL_Surface* AssetManagerImpl::decode_image(const std::string& path, ArchiveBlob blob, std::uint64_t& content_hash) {
+		FileData file;
+		std::uint64_t mtime = 0; // archive entries have no mtime, their content hash is enough
+
+		// Images are decoded from memory, so the same bytes give the hash that identical images are shared by
+		if (!blob) {
+			file = read_file(path);
+			if (!file) {
+				return nullptr;
+			}
+
+			blob = ArchiveBlob{ file->data(), file->size() };
+		}
+
+		content_hash = hash_data(blob.data, blob.size);
+
+		if (!disk_cache.is_enabled()) {
+			return IMG_Load_IO(SDL_IOFromConstMem(blob.data, blob.size), true);
+		}
+
+		// The cache entry is checked against the source's mtime and contents
+		if (file) {
+			std::error_code ec;
+			mtime = static_cast<std::uint64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+		}
+
+		if (SDL_Surface* cached = disk_cache.load(path, mtime, content_hash)) {
+			return cached;
+		}
+
+		SDL_Surface* surface = convert_surface(IMG_Load_IO(SDL_IOFromConstMem(blob.data, blob.size), true), native_format);
+		if (surface) {
+			disk_cache.store(path, mtime, content_hash, surface); // a failed store only costs the next run a decode
+		}
+
+		return surface;
+	}
+
+	void AssetManagerImpl::resolve(PendingTexture& pending, std::shared_ptr<penguin::rendering::primitives::Texture> texture) {
+		{
+			std::lock_guard<std::mutex> lock(upload_mutex);
+			texture_requests.erase(pending.path); // later requests find the texture in the loader's cache
+		}
+
+		pending.promise->set_value(std::move(texture));
+	}
+
+	void AssetManagerImpl::resolve(PendingFont& pending, std::shared_ptr<penguin::rendering::primitives::Font> font) {
+		{
+			std::lock_guard<std::mutex> lock(upload_mutex);
+			font_requests.erase(FontKey{ pending.path, pending.size, pending.outline, pending.style });
+		}
+
+		pending.promise->set_value(std::move(font));
 	}
 
 	bool AssetManagerImpl::has_valid_image_ext(const std::filesystem::path& path) {
@@ -43,6 +528,24 @@ namespace penguin::internal::rendering::systems {
 		return valid_image_ext.find(ext) != valid_image_ext.end();
 	}
 
+	bool AssetManagerImpl::has_svg_ext(const std::filesystem::path& path) {
+		std::string ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower); // make lowercase
+
+		return ext == ".svg";
+	}
+
+	int AssetManagerImpl::get_svg_size_bucket(int size) {
+		int shift = 0;
+		while ((size >> shift) >= 16) {
+			++shift;
+		}
+
+		// Keeping the top 4 bits (rounded up) bounds the extra pixels to 1/8 of the size
+		const std::int64_t mask = (std::int64_t{ 1 } << shift) - 1;
+		return static_cast<int>(std::min<std::int64_t>(((size + mask) >> shift) << shift, std::numeric_limits<int>::max()));
+	}
+
 	bool AssetManagerImpl::has_valid_font_ext(const std::filesystem::path& path) {
 		std::string ext = path.extension().string();
 		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower); // make lowercase
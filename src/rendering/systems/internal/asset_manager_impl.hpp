@@ -3,22 +3,78 @@
 #include <penguin_framework/common/native_types.hpp>
 #include <penguin_framework/rendering/systems/texture_loader.hpp>
 #include <penguin_framework/rendering/systems/font_loader.hpp>
+#include <penguin_framework/rendering/systems/asset_handle.hpp>
+#include <penguin_framework/rendering/systems/preload_manifest.hpp>
+#include <penguin_framework/rendering/systems/texture_info.hpp>
 #include <penguin_framework/rendering/primitives/texture.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/font_style.hpp>
 
 #include <penguin_framework/math/rect2.hpp>
 #include <penguin_framework/math/circle2.hpp>
 #include <penguin_framework/math/colours.hpp>
 #include <penguin_framework/math/vector2i.hpp>
 
+#include <rendering/systems/internal/worker_pool.hpp>
+#include <rendering/systems/internal/file_io.hpp>
+#include <rendering/systems/internal/asset_archive.hpp>
+#include <rendering/systems/internal/texture_disk_cache.hpp>
+#include <rendering/systems/internal/font_loader_impl.hpp>
 #include <error/internal/internal_error.hpp>
 
+#include <SDL3/SDL_surface.h>
+
 #include <memory>
 #include <unordered_set>
 #include <filesystem>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <string>
 
 namespace penguin::internal::rendering::systems {
 
+	// An image decoded on a worker thread, waiting for the render thread to upload it
+	struct PendingTexture {
+		std::string path;
+		std::unique_ptr<SDL_Surface, void(*)(SDL_Surface*)> surface;
+		std::uint64_t content_hash; // of the source file, identical images share one texture
+		std::shared_ptr<std::promise<std::shared_ptr<penguin::rendering::primitives::Texture>>> promise;
+	};
+
+	// A font file read on a worker thread, waiting to be opened on the render thread
+	struct PendingFont {
+		std::string path;
+		float size;
+		int outline;
+		penguin::rendering::primitives::FontStyle style;
+		FileData data;
+		std::shared_ptr<std::promise<std::shared_ptr<penguin::rendering::primitives::Font>>> promise;
+	};
+
+	// Interning key of a font handle: the hashed path plus the options that make it a distinct font
+	struct FontHandleKey {
+		std::uint64_t path_hash;
+		float size;
+		int outline;
+		penguin::rendering::primitives::FontStyle style;
+
+		bool operator==(const FontHandleKey& other) const = default;
+	};
+
+	struct FontHandleKeyHash {
+		std::size_t operator()(const FontHandleKey& key) const;
+	};
+
+	// An archive whose entries are visible under mount_point (empty for the root)
+	struct MountedArchive {
+		std::unique_ptr<AssetArchive> archive;
+		std::string mount_point;
+	};
+
 	class AssetManagerImpl {
 	public:
 		NativeRendererPtr renderer_ptr;
@@ -26,6 +82,7 @@ namespace penguin::internal::rendering::systems {
 		penguin::rendering::systems::FontLoader font_loader;
 
 		AssetManagerImpl(NativeRendererPtr renderer);
+		~AssetManagerImpl();
 
 		// Copy & move (including assigment) not allowed
 
@@ -35,10 +92,77 @@ namespace penguin::internal::rendering::systems {
 		AssetManagerImpl& operator=(AssetManagerImpl&&) noexcept = delete;
 
 		std::shared_ptr<penguin::rendering::primitives::Texture> load_texture(const char* path);
-		std::shared_ptr<penguin::rendering::primitives::Font> load_font(const char* path, float size, int outline);
+		std::shared_ptr<penguin::rendering::primitives::Texture> load_texture(const char* path, penguin::math::Vector2i target_size); // SVGs rasterised per size bucket
+		std::shared_ptr<penguin::rendering::primitives::Font> load_font(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style,
+			const char* prewarm_charset = nullptr);
+
+		// Asynchronous loading: decoding runs on the worker pool, uploads run in process_uploads() on the render thread
+
+		std::shared_future<std::shared_ptr<penguin::rendering::primitives::Texture>> load_texture_async(const char* path);
+		std::shared_future<std::shared_ptr<penguin::rendering::primitives::Font>> load_font_async(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style);
+		std::size_t process_uploads(float budget_ms);
+		std::size_t get_pending_uploads();
+		std::size_t preload(const penguin::rendering::systems::PreloadManifest& manifest, const penguin::rendering::systems::PreloadCallback& on_progress);
+
+		// Packed archives: later mounts shadow earlier ones, loose files are only read when no archive has the path
+
+		bool mount_archive(const char* path, const char* mount_point);
+
+		penguin::rendering::systems::TextureInfo probe_texture(const char* path);
+
+		// Interned handles: the path is hashed once, after which the asset resolves through a dense table.
+		// The table keeps its assets loaded. Render thread only, like the synchronous loads.
+
+		penguin::rendering::systems::TextureHandle load_texture_handle(const char* path);
+		penguin::rendering::systems::FontHandle load_font_handle(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style);
+		penguin::rendering::systems::TextureHandle find_texture_handle(penguin::rendering::systems::AssetId id) const;
+		penguin::rendering::systems::FontHandle find_font_handle(penguin::rendering::systems::AssetId id, float size, int outline, penguin::rendering::primitives::FontStyle style) const;
+
+		const std::shared_ptr<penguin::rendering::primitives::Texture>& get_texture(penguin::rendering::systems::TextureHandle handle) const {
+			return handle.index < texture_handles.size() ? texture_handles[handle.index] : no_texture;
+		}
+
+		const std::shared_ptr<penguin::rendering::primitives::Font>& get_font(penguin::rendering::systems::FontHandle handle) const {
+			return handle.index < font_handles.size() ? font_handles[handle.index] : no_font;
+		}
+
+		TextureDiskCache disk_cache; // decoded images in the renderer's format, disabled until given a directory
 
 	private:
+		ArchiveBlob find_in_archives(const char* path);
+		// Reads, hashes and decodes the image, through the disk cache when it is enabled. Safe on any thread.
+		SDL_Surface* decode_image(const std::string& path, ArchiveBlob blob, std::uint64_t& content_hash);
+
+		SDL_PixelFormat native_format; // the format images are cached in
+
+		std::unordered_map<std::uint64_t, std::uint32_t> texture_handle_ids; // path hash -> index into texture_handles
+		std::vector<std::shared_ptr<penguin::rendering::primitives::Texture>> texture_handles;
+		std::vector<std::string> texture_handle_paths; // the interned paths, to catch hash collisions
+		std::unordered_map<FontHandleKey, std::uint32_t, FontHandleKeyHash> font_handle_ids;
+		std::vector<std::shared_ptr<penguin::rendering::primitives::Font>> font_handles;
+		std::vector<std::string> font_handle_paths;
+		const std::shared_ptr<penguin::rendering::primitives::Texture> no_texture;
+		const std::shared_ptr<penguin::rendering::primitives::Font> no_font;
+
+		bool upload_next(); // returns false once both queues are empty
+		void resolve(PendingTexture& pending, std::shared_ptr<penguin::rendering::primitives::Texture> texture);
+		void resolve(PendingFont& pending, std::shared_ptr<penguin::rendering::primitives::Font> font);
+
+		std::mutex upload_mutex;
+		std::deque<PendingTexture> texture_uploads;
+		std::deque<PendingFont> font_uploads;
+
+		// Requests that are decoding or waiting for upload, so asking for the same asset again shares the load
+		std::unordered_map<std::string, std::shared_future<std::shared_ptr<penguin::rendering::primitives::Texture>>> texture_requests;
+		std::unordered_map<FontKey, std::shared_future<std::shared_ptr<penguin::rendering::primitives::Font>>, FontKeyHash> font_requests;
+
+		std::shared_mutex archive_mutex;
+		std::vector<MountedArchive> archives; // never unmounted, so blobs handed to the workers stay mapped
+		WorkerPool workers; // declared last, so the workers are joined before the queues they push into are destroyed
+
 		bool has_valid_image_ext(const std::filesystem::path& path);
+		bool has_svg_ext(const std::filesystem::path& path);
+		static int get_svg_size_bucket(int size); // rounds up to 8 to 15 times a power of two, so buckets are at most 1/8 apart
 		bool has_valid_font_ext(const std::filesystem::path& path);
 		const std::unordered_set<std::string> valid_image_ext = { ".png", ".jpg", ".jpeg", ".bmp", ".gif", ".svg"};
 		const std::unordered_set<std::string> valid_font_ext = { ".ttf", ".otf" };
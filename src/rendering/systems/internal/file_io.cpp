@@ -0,0 +1,38 @@
+#include <rendering/systems/internal/file_io.hpp>
+
+#include <fstream>
+
+namespace penguin::internal::rendering::systems {
+
+	FileData read_file(const std::string& path) {
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file) {
+			return nullptr;
+		}
+
+		std::streamsize file_size = file.tellg();
+		if (file_size <= 0) {
+			return nullptr;
+		}
+
+		auto buffer = std::make_shared<std::vector<unsigned char>>(static_cast<std::size_t>(file_size));
+		file.seekg(0, std::ios::beg);
+
+		if (!file.read(reinterpret_cast<char*>(buffer->data()), file_size)) {
+			return nullptr;
+		}
+
+		return buffer;
+	}
+
+	std::uint64_t hash_data(const unsigned char* data, std::size_t size) {
+		std::uint64_t hash = 14695981039346656037ull; // FNV-1a offset basis
+
+		for (std::size_t i = 0; i < size; ++i) {
+			hash ^= data[i];
+			hash *= 1099511628211ull; // FNV-1a prime
+		}
+
+		return hash;
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace penguin::internal::rendering::systems {
+
+	using FileData = std::shared_ptr<const std::vector<unsigned char>>;
+
+	// Reads a whole file into memory. Returns nullptr if the file cannot be opened, is empty or cannot be read.
+	// Safe to call from any thread.
+	FileData read_file(const std::string& path);
+
+	std::uint64_t hash_data(const unsigned char* data, std::size_t size); // 64-bit FNV-1a, used to tell whether a file's contents changed
+}
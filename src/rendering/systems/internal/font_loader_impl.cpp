@@ -1,24 +1,102 @@
 #include <rendering/systems/internal/font_loader_impl.hpp>
 
+#include <functional>
+
 namespace penguin::internal::rendering::systems {
 
-    // WORKS ONLY ON SINGLE THREAD
-    std::shared_ptr<penguin::rendering::primitives::Font> FontLoaderImpl::load(const char* path, float size, int outline) {
-        std::string path_str(path);
+    using penguin::rendering::primitives::FontStyle;
+
+    std::size_t FontKeyHash::operator()(const FontKey& key) const {
+        std::size_t seed = std::hash<std::string>{}(key.path);
+
+        auto combine = [&seed](std::size_t value) {
+            seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        };
+
+        combine(std::hash<float>{}(key.size));
+        combine(std::hash<int>{}(key.outline));
+        combine(std::hash<uint32_t>{}(static_cast<uint32_t>(key.style)));
+
+        return seed;
+    }
+
+    std::shared_ptr<penguin::rendering::primitives::Font> FontLoaderImpl::load(const char* path, float size, int outline, FontStyle style, FontData preloaded) {
+        // A font that is already cached (or being opened by another thread) is shared instead of opened again
+        return font_cache.get_or_load(FontKey{ std::string(path), size, outline, style }, [&]() {
+            // Open it over the shared in-memory file (read once for every size / style)
+            FontData data = get_file(path, std::move(preloaded));
+            std::shared_ptr<penguin::rendering::primitives::Font> new_font = data
+                ? std::make_shared<penguin::rendering::primitives::Font>(data, size, outline)
+                : std::make_shared<penguin::rendering::primitives::Font>(path, size, outline); // fall back to opening from disk, which logs the failure
+
+            if (new_font->is_valid()) {
+                apply_style(*new_font, style);
+            }
+
+            // The font file is the bulk of an open font, and is counted once in the cache's shared bytes for as long as any font holds it
+            return CacheLoad<std::shared_ptr<penguin::rendering::primitives::Font>>{ new_font, 0 };
+        });
+    }
+
+    std::shared_ptr<penguin::rendering::primitives::Font> FontLoaderImpl::find(const char* path, float size, int outline, FontStyle style) const {
+        return font_cache.find(FontKey{ std::string(path), size, outline, style });
+    }
+
+    FontData FontLoaderImpl::get_file(const std::string& path, FontData preloaded) {
+        {
+            std::lock_guard<std::mutex> lock(file_cache_mutex);
 
-        auto it = font_cache.find(path_str);
-        if (it != font_cache.end()) {
-            // Found in cache, return the existing shared_ptr
-            return it->second;
+            auto it = file_cache.find(path);
+            if (it != file_cache.end()) {
+                if (FontData data = it->second.lock()) {
+                    return data; // another size / style of this file is still alive
+                }
+            }
         }
 
-        // Not found in cache, load it
-        std::shared_ptr<penguin::rendering::primitives::Font> new_font = std::make_shared<penguin::rendering::primitives::Font>(path, size, outline);
+        FontData data = preloaded ? std::move(preloaded) : read_file(path); // read without holding the lock
 
-        // Add to cache
-        font_cache[path_str] = new_font; // NOTE: Only works on a single thread
+        if (data) {
+            std::lock_guard<std::mutex> lock(file_cache_mutex);
 
-        return new_font;
+            std::weak_ptr<const std::vector<unsigned char>>& cached = file_cache[path];
+            if (FontData other = cached.lock()) {
+                return other; // another thread read the same file meanwhile, share its copy
+            }
+
+            data = track_file_bytes(std::move(data));
+            cached = data;
+        }
+
+        return data;
+    }
+
+    FontData FontLoaderImpl::track_file_bytes(FontData file) {
+        const std::size_t bytes = file->size();
+        std::shared_ptr<std::atomic<std::size_t>> shared_bytes = font_cache.get_shared_bytes();
+        shared_bytes->fetch_add(bytes, std::memory_order_relaxed);
+
+        // Released when the last font using the file lets go of it, even if that is after the loader is gone
+        const std::vector<unsigned char>* buffer = file.get();
+        return FontData(buffer, [file = std::move(file), shared_bytes = std::move(shared_bytes), bytes](const std::vector<unsigned char>*) mutable {
+            shared_bytes->fetch_sub(bytes, std::memory_order_relaxed);
+            file.reset();
+        });
+    }
+
+    void FontLoaderImpl::apply_style(penguin::rendering::primitives::Font& font, FontStyle style) {
+        if ((style & FontStyle::Bold) == FontStyle::Bold) {
+            font.make_bold();
+        }
+        if ((style & FontStyle::Italic) == FontStyle::Italic) {
+            font.make_italic();
+        }
+        if ((style & FontStyle::Underline) == FontStyle::Underline) {
+            font.make_underline();
+        }
+        if ((style & FontStyle::Strikethrough) == FontStyle::Strikethrough) {
+            font.make_strikethrough();
+        }
     }
 
-}
\ No newline at end of file
+}
@@ -3,19 +3,43 @@
 
 #include <penguin_framework/common/native_types.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/font_style.hpp>
 
+#include <rendering/systems/internal/file_io.hpp>
+#include <rendering/systems/internal/sharded_cache.hpp>
 #include <error/internal/internal_error.hpp>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <mutex>
+#include <cstddef>
 
 namespace penguin::internal::rendering::systems {
 
+	// Every parameter that makes two loaded fonts different
+	struct FontKey {
+		std::string path;
+		float size;
+		int outline;
+		penguin::rendering::primitives::FontStyle style;
+
+		bool operator==(const FontKey& other) const = default;
+	};
+
+	struct FontKeyHash {
+		std::size_t operator()(const FontKey& key) const;
+	};
+
+	using FontData = FileData;
+
 	struct FontLoaderImpl {
 
-		std::unordered_map<std::string, std::shared_ptr<penguin::rendering::primitives::Font>> font_cache;
+		ShardedCache<FontKey, std::shared_ptr<penguin::rendering::primitives::Font>, FontKeyHash> font_cache; // safe to use from several threads
+		std::unordered_map<std::string, std::weak_ptr<const std::vector<unsigned char>>> file_cache; // released once no font uses the file
+		std::mutex file_cache_mutex;
 
 		FontLoaderImpl() = default;
 
@@ -28,6 +52,13 @@ namespace penguin::internal::rendering::systems {
 
 		// Load function
 
-		std::shared_ptr<penguin::rendering::primitives::Font> load(const char* path, float size, int outline);
+		std::shared_ptr<penguin::rendering::primitives::Font> load(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style,
+			FontData preloaded = nullptr);
+		std::shared_ptr<penguin::rendering::primitives::Font> find(const char* path, float size, int outline, penguin::rendering::primitives::FontStyle style) const;
+
+	private:
+		FontData get_file(const std::string& path, FontData preloaded);
+		FontData track_file_bytes(FontData file); // counts the file in the cache's shared bytes until its last user releases it
+		static void apply_style(penguin::rendering::primitives::Font& font, penguin::rendering::primitives::FontStyle style);
 	};
-}
\ No newline at end of file
+}
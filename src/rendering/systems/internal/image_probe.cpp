@@ -0,0 +1,198 @@
+#include <rendering/systems/internal/image_probe.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace penguin::internal::rendering::systems {
+
+	namespace {
+
+		using penguin::rendering::systems::ImageFormat;
+		using penguin::rendering::systems::TextureInfo;
+
+		class MemoryReader {
+		public:
+			MemoryReader(const unsigned char* p_data, std::size_t p_size) : data(p_data), size(p_size) {}
+
+			bool read(std::size_t offset, unsigned char* out, std::size_t count) {
+				if (!data || offset > size || count > size - offset) {
+					return false;
+				}
+
+				std::memcpy(out, data + offset, count);
+				return true;
+			}
+
+		private:
+			const unsigned char* data;
+			std::size_t size;
+		};
+
+		class FileReader {
+		public:
+			explicit FileReader(const char* path) : file(path, std::ios::binary) {}
+
+			bool read(std::size_t offset, unsigned char* out, std::size_t count) {
+				if (!file) {
+					return false;
+				}
+
+				file.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+				return static_cast<bool>(file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(count)));
+			}
+
+		private:
+			std::ifstream file;
+		};
+
+		std::uint32_t read_be16(const unsigned char* bytes) {
+			return (static_cast<std::uint32_t>(bytes[0]) << 8) | bytes[1];
+		}
+
+		std::uint32_t read_be32(const unsigned char* bytes) {
+			return (static_cast<std::uint32_t>(bytes[0]) << 24) | (static_cast<std::uint32_t>(bytes[1]) << 16) | (static_cast<std::uint32_t>(bytes[2]) << 8) | bytes[3];
+		}
+
+		std::uint32_t read_le16(const unsigned char* bytes) {
+			return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8);
+		}
+
+		std::uint32_t read_le32(const unsigned char* bytes) {
+			return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8) | (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+		}
+
+		TextureInfo make_info(ImageFormat format, std::int64_t width, std::int64_t height) {
+			constexpr std::int64_t Max_Dimension = 0x7FFFFFFF;
+
+			if (width <= 0 || height <= 0 || width > Max_Dimension || height > Max_Dimension) {
+				return {}; // a header this broken would not decode either
+			}
+
+			return TextureInfo{ penguin::math::Vector2i(static_cast<int>(width), static_cast<int>(height)), format };
+		}
+
+		// The size is in the frame header (SOFn), found by walking the segment headers from the start of the file
+		template <typename Reader>
+		TextureInfo probe_jpeg(Reader& reader) {
+			constexpr int Max_Segments = 1024; // stops a corrupt file from being walked forever
+
+			std::size_t offset = 2; // after the SOI marker
+			unsigned char header[9];
+
+			for (int segment = 0; segment < Max_Segments; ++segment) {
+				if (!reader.read(offset, header, 2)) {
+					return {};
+				}
+
+				if (header[0] != 0xFF) {
+					return {};
+				}
+
+				const unsigned char marker = header[1];
+
+				if (marker == 0xFF) {
+					offset += 1; // fill byte before the marker
+					continue;
+				}
+
+				if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {
+					offset += 2; // markers without a length
+					continue;
+				}
+
+				if (marker == 0xD9 || marker == 0xDA) {
+					return {}; // the image ended, or its data started, before a frame header
+				}
+
+				if (!reader.read(offset + 2, header + 2, 2)) {
+					return {};
+				}
+
+				const std::uint32_t length = read_be16(header + 2);
+				if (length < 2) {
+					return {};
+				}
+
+				// SOF0 to SOF15, apart from DHT (C4), JPG (C8) and DAC (CC)
+				if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+					if (!reader.read(offset + 4, header + 4, 5)) {
+						return {};
+					}
+
+					return make_info(ImageFormat::Jpeg, read_be16(header + 7), read_be16(header + 5)); // precision, height, width
+				}
+
+				offset += 2 + length;
+			}
+
+			return {};
+		}
+
+		template <typename Reader>
+		TextureInfo probe(Reader& reader) {
+			unsigned char header[26];
+
+			if (!reader.read(0, header, 2)) {
+				return {};
+			}
+
+			// JPEG: SOI marker
+			if (header[0] == 0xFF && header[1] == 0xD8) {
+				return probe_jpeg(reader);
+			}
+
+			// BMP: "BM", then the size of the DIB header tells its layout
+			if (header[0] == 'B' && header[1] == 'M') {
+				if (!reader.read(0, header, 26)) {
+					return {};
+				}
+
+				if (read_le32(header + 14) == 12) { // BITMAPCOREHEADER, 16-bit sizes
+					return make_info(ImageFormat::Bmp, read_le16(header + 18), read_le16(header + 20));
+				}
+
+				// A negative height means the rows are stored top-down
+				const std::int32_t height = static_cast<std::int32_t>(read_le32(header + 22));
+				return make_info(ImageFormat::Bmp, static_cast<std::int32_t>(read_le32(header + 18)), std::llabs(static_cast<long long>(height)));
+			}
+
+			if (!reader.read(0, header, 10)) {
+				return {};
+			}
+
+			// GIF: "GIF87a" or "GIF89a", then the logical screen size
+			if (std::memcmp(header, "GIF87a", 6) == 0 || std::memcmp(header, "GIF89a", 6) == 0) {
+				return make_info(ImageFormat::Gif, read_le16(header + 6), read_le16(header + 8));
+			}
+
+			// PNG: the signature, then the IHDR chunk
+			static constexpr unsigned char Png_Signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+
+			if (std::memcmp(header, Png_Signature, sizeof(Png_Signature)) == 0) {
+				if (!reader.read(0, header, 24) || std::memcmp(header + 12, "IHDR", 4) != 0) {
+					return {};
+				}
+
+				return make_info(ImageFormat::Png, read_be32(header + 16), read_be32(header + 20));
+			}
+
+			return {};
+		}
+	}
+
+	penguin::rendering::systems::TextureInfo probe_image(const char* path) {
+		if (!path) {
+			return {};
+		}
+
+		FileReader reader(path);
+		return probe(reader);
+	}
+
+	penguin::rendering::systems::TextureInfo probe_image(const unsigned char* data, std::size_t size) {
+		MemoryReader reader(data, size);
+		return probe(reader);
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <penguin_framework/rendering/systems/texture_info.hpp>
+
+#include <cstddef>
+
+namespace penguin::internal::rendering::systems {
+
+	// Reads the size and format from a PNG, JPEG, BMP or GIF header without decoding the image.
+	// The file version only reads the bytes it needs (for JPEG, the segment headers up to the frame header).
+	// Returns an info with ImageFormat::Unknown for other formats or a malformed header.
+
+	penguin::rendering::systems::TextureInfo probe_image(const char* path);
+	penguin::rendering::systems::TextureInfo probe_image(const unsigned char* data, std::size_t size);
+}
@@ -0,0 +1,117 @@
+#include <rendering/systems/internal/mapped_file.hpp>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace penguin::internal::rendering::systems {
+
+	MappedFile::~MappedFile() {
+		close();
+	}
+
+#ifdef _WIN32
+
+	bool MappedFile::open(const char* path) {
+		close();
+
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			CloseHandle(file);
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!view) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		file_handle = file;
+		mapping_handle = mapping;
+		data = static_cast<const unsigned char*>(view);
+		size = static_cast<std::size_t>(file_size.QuadPart);
+
+		return true;
+	}
+
+	void MappedFile::close() {
+		if (data) {
+			UnmapViewOfFile(data);
+		}
+		if (mapping_handle) {
+			CloseHandle(mapping_handle);
+		}
+		if (file_handle) {
+			CloseHandle(file_handle);
+		}
+
+		data = nullptr;
+		size = 0;
+		file_handle = nullptr;
+		mapping_handle = nullptr;
+	}
+
+#else
+
+	bool MappedFile::open(const char* path) {
+		close();
+
+		int fd = ::open(path, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat info {};
+		if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+			::close(fd);
+			return false;
+		}
+
+		void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd); // the mapping keeps the file alive
+
+		if (view == MAP_FAILED) {
+			return false;
+		}
+
+		data = static_cast<const unsigned char*>(view);
+		size = static_cast<std::size_t>(info.st_size);
+
+		return true;
+	}
+
+	void MappedFile::close() {
+		if (data) {
+			munmap(const_cast<unsigned char*>(data), size);
+		}
+
+		data = nullptr;
+		size = 0;
+	}
+
+#endif
+}
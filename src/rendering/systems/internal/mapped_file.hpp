@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace penguin::internal::rendering::systems {
+
+	// Read-only memory mapping of a whole file. Pages are only read from disk when they are touched.
+	class MappedFile {
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		// Copy & move (including assigment) not allowed
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&&) noexcept = delete;
+		MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+		bool open(const char* path); // returns false if the file cannot be opened or mapped (an empty file cannot be mapped)
+		void close();
+
+		bool is_open() const { return data != nullptr; }
+		const unsigned char* get_data() const { return data; }
+		std::size_t get_size() const { return size; }
+
+	private:
+		const unsigned char* data = nullptr;
+		std::size_t size = 0;
+
+#ifdef _WIN32
+		void* file_handle = nullptr;
+		void* mapping_handle = nullptr;
+#endif
+	};
+}
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <penguin_framework/rendering/systems/cache_stats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace penguin::internal::rendering::systems {
+
+	// What a cache loader returns: the value, the memory it holds, and whether to keep it (a failed load is not)
+	template <typename Value>
+	struct CacheLoad {
+		Value value;
+		std::size_t bytes;
+		bool cached = true;
+	};
+
+	// Thread-safe cache of shared pointers split into independently locked shards, so loads of different keys rarely contend.
+	// Lookups only take a shard's shared lock. A key that is being loaded is stored as an in-flight future,
+	// so concurrent requests for it wait for that one load instead of loading it again.
+	// With a memory budget, entries that nothing else references are evicted least recently used first.
+	// An eviction callback lets the owner drop its own bookkeeping for an evicted key.
+	// Memory that several values share (a font file opened at several sizes) is counted once in the shared bytes,
+	// which its owner adds and releases itself; evicting the values that hold it then frees it.
+	template <typename Key, typename Value, typename Hash = std::hash<Key>, std::size_t Shard_Count = 16>
+	class ShardedCache {
+	public:
+		using EvictCallback = std::function<void(const Key&)>;
+
+		ShardedCache() = default;
+		explicit ShardedCache(EvictCallback p_on_evict) : on_evict(std::move(p_on_evict)) {}
+
+		// Copy & move (including assigment) not allowed
+
+		ShardedCache(const ShardedCache&) = delete;
+		ShardedCache& operator=(const ShardedCache&) = delete;
+		ShardedCache(ShardedCache&&) noexcept = delete;
+		ShardedCache& operator=(ShardedCache&&) noexcept = delete;
+
+		// Returns the cached value, waits for an in-flight load of the key, or runs the loader once and caches its result.
+		// The loader returns a CacheLoad with the value and its size in bytes.
+		template <typename Loader>
+		Value get_or_load(const Key& key, Loader&& loader) {
+			Shard& shard = shard_for(key);
+
+			{
+				std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+				auto it = shard.entries.find(key);
+				if (it != shard.entries.end()) {
+					return wait_for_hit(it->second, lock);
+				}
+			}
+
+			std::promise<Value> promise;
+
+			{
+				std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+				auto it = shard.entries.find(key);
+				if (it != shard.entries.end()) { // another thread started loading it in the meantime
+					return wait_for_hit(it->second, lock);
+				}
+
+				shard.entries.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(promise.get_future().share(), next_tick()));
+				misses.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			CacheLoad<Value> loaded;
+
+			try {
+				loaded = loader(); // runs without holding the lock
+			}
+			catch (...) {
+				{
+					std::unique_lock<std::shared_mutex> lock(shard.mutex);
+					shard.entries.erase(key); // let the next request try again
+				}
+
+				promise.set_exception(std::current_exception());
+				throw;
+			}
+
+			{
+				// Account for the entry before it becomes ready, eviction skips entries that are still loading
+				std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+				auto it = shard.entries.find(key);
+				if (it != shard.entries.end()) {
+					if (!loaded.cached) {
+						shard.entries.erase(it); // the requests already waiting still get the value, the next one loads again
+					}
+					else {
+						it->second.bytes = loaded.bytes;
+						resident_bytes.fetch_add(loaded.bytes, std::memory_order_relaxed);
+					}
+				}
+			}
+
+			promise.set_value(loaded.value);
+			enforce_budget();
+
+			return loaded.value;
+		}
+
+		// Returns the cached value (counted as a hit), or a default constructed value if the key is missing or still loading
+		Value find(const Key& key) const {
+			const Shard& shard = shard_for(key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+			auto it = shard.entries.find(key);
+			if (it == shard.entries.end() || !is_ready(it->second)) {
+				return Value{};
+			}
+
+			it->second.last_used.store(next_tick(), std::memory_order_relaxed);
+			hits.fetch_add(1, std::memory_order_relaxed);
+
+			return it->second.value.get();
+		}
+
+		// Memory budget
+
+		void set_budget(std::size_t bytes) {
+			budget_bytes.store(bytes, std::memory_order_relaxed);
+			enforce_budget();
+		}
+
+		std::size_t get_budget() const {
+			return budget_bytes.load(std::memory_order_relaxed);
+		}
+
+		// Evicts unreferenced entries, least recently used first, until the cache fits in the given size
+		void evict_to(std::size_t target_bytes) {
+			if (get_resident_bytes() <= target_bytes) {
+				return;
+			}
+
+			evict(target_bytes, false);
+		}
+
+		// Evicts every unreferenced entry, including those that hold no bytes (e.g. failed loads or fonts sharing a file)
+		void evict_unused() {
+			evict(0, true);
+		}
+
+		// Held through a shared pointer, so a shared buffer that outlives the cache can still release its bytes
+		std::shared_ptr<std::atomic<std::size_t>> get_shared_bytes() const {
+			return shared_bytes;
+		}
+
+		// Statistics
+
+		penguin::rendering::systems::CacheStats get_stats() const {
+			penguin::rendering::systems::CacheStats stats;
+			stats.resident_bytes = get_resident_bytes();
+			stats.budget_bytes = budget_bytes.load(std::memory_order_relaxed);
+			stats.entries = get_size();
+			stats.hits = hits.load(std::memory_order_relaxed);
+			stats.misses = misses.load(std::memory_order_relaxed);
+			stats.evictions = evictions.load(std::memory_order_relaxed);
+
+			return stats;
+		}
+
+		std::size_t get_size() const {
+			std::size_t size = 0;
+
+			for (const Shard& shard : shards) {
+				std::shared_lock<std::shared_mutex> lock(shard.mutex);
+				size += shard.entries.size();
+			}
+
+			return size;
+		}
+
+	private:
+		struct Entry {
+			std::shared_future<Value> value;
+			std::size_t bytes;
+			mutable std::atomic<std::uint64_t> last_used; // updated on hits under the shared lock
+
+			Entry(std::shared_future<Value> p_value, std::uint64_t tick) : value(std::move(p_value)), bytes(0), last_used(tick) {}
+		};
+
+		struct Shard {
+			mutable std::shared_mutex mutex;
+			std::unordered_map<Key, Entry, Hash> entries;
+		};
+
+		template <typename Lock>
+		Value wait_for_hit(const Entry& entry, Lock& lock) {
+			entry.last_used.store(next_tick(), std::memory_order_relaxed);
+			hits.fetch_add(1, std::memory_order_relaxed);
+
+			std::shared_future<Value> pending = entry.value;
+			lock.unlock(); // an in-flight load is waited for without holding the shard
+
+			return pending.get();
+		}
+
+		static bool is_ready(const Entry& entry) {
+			return entry.value.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+
+		// Loaded, and only referenced by the cache itself
+		static bool is_evictable(const Entry& entry) {
+			return is_ready(entry) && entry.value.get().use_count() == 1;
+		}
+
+		// Stops once the cache fits in target_bytes, unless evict_all is set
+		void evict(std::size_t target_bytes, bool evict_all) {
+			// Gather the candidates under shared locks, then evict them in LRU order
+			struct Candidate {
+				std::uint64_t last_used;
+				std::size_t shard;
+				Key key;
+			};
+
+			std::vector<Candidate> candidates;
+
+			for (std::size_t i = 0; i < Shard_Count; ++i) {
+				std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+
+				for (const auto& [key, entry] : shards[i].entries) {
+					if (is_evictable(entry)) {
+						candidates.push_back({ entry.last_used.load(std::memory_order_relaxed), i, key });
+					}
+				}
+			}
+
+			std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.last_used < b.last_used; });
+
+			for (const Candidate& candidate : candidates) {
+				if (!evict_all && get_resident_bytes() <= target_bytes) {
+					break;
+				}
+
+				{
+					Shard& shard = shards[candidate.shard];
+					std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+					auto it = shard.entries.find(candidate.key);
+					if (it == shard.entries.end() || !is_evictable(it->second)) {
+						continue; // picked up again since it was gathered
+					}
+
+					resident_bytes.fetch_sub(it->second.bytes, std::memory_order_relaxed);
+					shard.entries.erase(it);
+					evictions.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				if (on_evict) {
+					on_evict(candidate.key); // called without holding the shard
+				}
+			}
+		}
+
+		std::size_t get_resident_bytes() const {
+			return resident_bytes.load(std::memory_order_relaxed) + shared_bytes->load(std::memory_order_relaxed);
+		}
+
+		void enforce_budget() {
+			std::size_t budget = budget_bytes.load(std::memory_order_relaxed);
+
+			if (budget > 0) {
+				evict_to(budget);
+			}
+		}
+
+		std::uint64_t next_tick() const {
+			return clock.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Shard& shard_for(const Key& key) {
+			return shards[hasher(key) % Shard_Count];
+		}
+
+		const Shard& shard_for(const Key& key) const {
+			return shards[hasher(key) % Shard_Count];
+		}
+
+		std::array<Shard, Shard_Count> shards;
+		Hash hasher;
+		EvictCallback on_evict;
+
+		mutable std::atomic<std::uint64_t> clock{ 0 }; // logical time for LRU ordering
+		std::atomic<std::size_t> resident_bytes{ 0 }; // charged to the entries themselves
+		std::shared_ptr<std::atomic<std::size_t>> shared_bytes = std::make_shared<std::atomic<std::size_t>>(0);
+		std::atomic<std::size_t> budget_bytes{ 0 }; // 0 means unlimited
+		mutable std::atomic<std::uint64_t> hits{ 0 }; // find() is const
+		std::atomic<std::uint64_t> misses{ 0 };
+		std::atomic<std::uint64_t> evictions{ 0 };
+	};
+}
@@ -2,11 +2,13 @@
 
 namespace penguin::internal::rendering::systems {
 
-	TextContextImpl::TextContextImpl(NativeRendererPtr renderer) : context(TTF_CreateRendererTextEngine(renderer.as<SDL_Renderer>()), &TTF_DestroyRendererTextEngine) {
+	TextContextImpl::TextContextImpl(NativeRendererPtr renderer, std::size_t layout_cache_capacity) 
+		: context(TTF_CreateRendererTextEngine(renderer.as<SDL_Renderer>()), &TTF_DestroyRendererTextEngine),
+		layout_cache(context.get(), layout_cache_capacity) {
 		penguin::internal::error::InternalError::throw_if(
 			!context,
 			"Failed to create the text context.",
 			penguin::internal::error::ErrorCode::Text_Context_Init_Failed
 		);
 	}
-}
\ No newline at end of file
+}
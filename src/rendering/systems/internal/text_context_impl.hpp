@@ -1,15 +1,18 @@
 #pragma once
 
 #include <penguin_framework/common/native_types.hpp>
+#include <rendering/systems/internal/text_layout_cache.hpp>
 #include <error/internal/internal_error.hpp>
 
 #include <SDL3_ttf/SDL_textengine.h>
 #include <memory>
+#include <cstddef>
 
 namespace penguin::internal::rendering::systems {
     struct TextContextImpl {
         std::unique_ptr<TTF_TextEngine, void(*)(TTF_TextEngine*)> context;
+        TextLayoutCache layout_cache; // declared after the context so cached layouts are destroyed before the engine
 
-        TextContextImpl(NativeRendererPtr renderer);
+        TextContextImpl(NativeRendererPtr renderer, std::size_t layout_cache_capacity = TextLayoutCache::Default_Capacity);
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,114 @@
+#include <rendering/systems/internal/text_layout_cache.hpp>
+
+#include <functional>
+
+namespace penguin::internal::rendering::systems {
+
+	TextLayoutCache::TextLayoutCache(TTF_TextEngine* p_engine, std::size_t p_capacity) : engine(p_engine), capacity(p_capacity) {}
+
+	std::shared_ptr<TextLayout> TextLayoutCache::acquire(TTF_Font* font, std::string_view str) {
+		TextLayoutKey key = make_key(font, str);
+		std::size_t key_hash = hash_key(key);
+
+		// Look for an existing layout, comparing the full string to rule out hash collisions
+		auto [first, last] = lookup.equal_range(key_hash);
+		for (auto it = first; it != last; ++it) {
+			EntryList::iterator entry = it->second;
+
+			if (entry->key == key && entry->str == str) {
+				// A closed font detaches itself from its texts, so a mismatch means the handle was reused by a new font
+				if (TTF_GetTextFont(entry->layout->text.get()) != font) {
+					lookup.erase(it);
+					entries.erase(entry);
+					break;
+				}
+
+				entries.splice(entries.begin(), entries, entry); // mark as most recently used
+				return entry->layout;
+			}
+		}
+
+		// Not found in cache, shape the string once and measure its bounds
+		TTF_Text* text = TTF_CreateText(engine, font, str.data(), str.size());
+		if (!text) {
+			return nullptr;
+		}
+
+		penguin::math::Vector2i size;
+		TTF_UpdateText(text);
+		TTF_GetTextSize(text, &size.x, &size.y);
+
+		std::shared_ptr<TextLayout> layout = std::make_shared<TextLayout>(text, size);
+
+		if (capacity == 0) {
+			return layout; // caching disabled, the caller is the only owner
+		}
+
+		// Add to cache
+		evict_to(capacity - 1);
+		entries.push_front(Entry{ key, std::string(str), layout });
+		lookup.emplace(key_hash, entries.begin());
+
+		return layout;
+	}
+
+	void TextLayoutCache::set_capacity(std::size_t new_capacity) {
+		capacity = new_capacity;
+		evict_to(capacity);
+	}
+
+	std::size_t TextLayoutCache::get_capacity() const {
+		return capacity;
+	}
+
+	std::size_t TextLayoutCache::get_size() const {
+		return entries.size();
+	}
+
+	void TextLayoutCache::clear() {
+		lookup.clear();
+		entries.clear();
+	}
+
+	TextLayoutKey TextLayoutCache::make_key(TTF_Font* font, std::string_view str) {
+		return TextLayoutKey{
+			font,
+			TTF_GetFontSize(font),
+			TTF_GetFontStyle(font),
+			TTF_GetFontOutline(font),
+			std::hash<std::string_view>{}(str)
+		};
+	}
+
+	std::size_t TextLayoutCache::hash_key(const TextLayoutKey& key) {
+		std::size_t seed = key.str_hash;
+
+		auto combine = [&seed](std::size_t value) {
+			seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+		};
+
+		combine(std::hash<TTF_Font*>{}(key.font));
+		combine(std::hash<float>{}(key.size));
+		combine(std::hash<TTF_FontStyleFlags>{}(key.style));
+		combine(std::hash<int>{}(key.outline));
+
+		return seed;
+	}
+
+	void TextLayoutCache::evict_to(std::size_t max_entries) {
+		while (entries.size() > max_entries) {
+			EntryList::iterator oldest = std::prev(entries.end());
+
+			// Remove the lookup slot that points at the least recently used entry
+			auto [first, last] = lookup.equal_range(hash_key(oldest->key));
+			for (auto it = first; it != last; ++it) {
+				if (it->second == oldest) {
+					lookup.erase(it);
+					break;
+				}
+			}
+
+			entries.erase(oldest);
+		}
+	}
+}
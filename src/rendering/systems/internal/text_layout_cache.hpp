@@ -0,0 +1,76 @@
+#pragma once
+
+#include <penguin_framework/math/vector2i.hpp>
+#include <penguin_framework/rendering/systems/text_context.hpp>
+
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include <memory>
+#include <list>
+#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace penguin::internal::rendering::systems {
+
+	// A shaped string, shared between every Text that displays the same string with the same font parameters
+	struct TextLayout {
+		std::unique_ptr<TTF_Text, void(*)(TTF_Text*)> text;
+		penguin::math::Vector2i size; // measured bounds of the shaped string
+
+		TextLayout(TTF_Text* p_text, penguin::math::Vector2i p_size) : text(p_text, &TTF_DestroyText), size(p_size) {}
+	};
+
+	struct TextLayoutKey {
+		TTF_Font* font;
+		float size;
+		TTF_FontStyleFlags style;
+		int outline;
+		std::size_t str_hash;
+
+		bool operator==(const TextLayoutKey& other) const = default;
+	};
+
+	// LRU cache of shaped strings, keyed by (font handle, size, style, outline, string hash).
+	// Evicting an entry only drops the cache's reference, so Text objects that still use the layout keep it alive.
+	class TextLayoutCache {
+	public:
+		static constexpr std::size_t Default_Capacity = penguin::rendering::systems::TextContext::Default_Layout_Cache_Capacity;
+
+		TextLayoutCache(TTF_TextEngine* p_engine, std::size_t p_capacity = Default_Capacity);
+
+		// Copy & move (including assigment) not allowed
+
+		TextLayoutCache(const TextLayoutCache&) = delete;
+		TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+		TextLayoutCache(TextLayoutCache&&) noexcept = delete;
+		TextLayoutCache& operator=(TextLayoutCache&&) noexcept = delete;
+
+		// Returns the cached layout for the string, shaping it first on a miss. Returns nullptr if shaping fails.
+		std::shared_ptr<TextLayout> acquire(TTF_Font* font, std::string_view str);
+
+		void set_capacity(std::size_t new_capacity);
+		std::size_t get_capacity() const;
+		std::size_t get_size() const;
+		void clear();
+
+	private:
+		struct Entry {
+			TextLayoutKey key;
+			std::string str; // compared on lookup, so hash collisions never return the wrong layout
+			std::shared_ptr<TextLayout> layout;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		TTF_TextEngine* engine;
+		std::size_t capacity;
+		EntryList entries; // most recently used at the front
+		std::unordered_multimap<std::size_t, EntryList::iterator> lookup;
+
+		static TextLayoutKey make_key(TTF_Font* font, std::string_view str);
+		static std::size_t hash_key(const TextLayoutKey& key);
+		void evict_to(std::size_t max_entries);
+	};
+}
@@ -0,0 +1,171 @@
+#include <rendering/systems/internal/texture_disk_cache.hpp>
+#include <rendering/systems/internal/file_io.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace penguin::internal::rendering::systems {
+
+	namespace {
+
+		struct EntryHeader {
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t mtime;
+			std::uint64_t content_hash;
+			std::uint32_t format;
+			std::uint32_t width;
+			std::uint32_t height;
+			std::uint32_t pitch;
+			std::uint32_t path_length;
+			std::uint32_t reserved; // keeps the header a multiple of 8 bytes
+		};
+	}
+
+	bool TextureDiskCache::set_directory(const std::string& path) {
+		std::lock_guard<std::mutex> lock(directory_mutex);
+
+		if (path.empty()) {
+			directory.clear();
+			return true;
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(path, ec);
+
+		if (ec || !std::filesystem::is_directory(path, ec)) {
+			directory.clear();
+			return false;
+		}
+
+		directory = path;
+		return true;
+	}
+
+	bool TextureDiskCache::is_enabled() const {
+		std::lock_guard<std::mutex> lock(directory_mutex);
+		return !directory.empty();
+	}
+
+	SDL_Surface* TextureDiskCache::load(const std::string& source_path, std::uint64_t mtime, std::uint64_t content_hash) const {
+		std::filesystem::path entry_path = get_entry_path(source_path);
+		if (entry_path.empty()) {
+			return nullptr;
+		}
+
+		std::ifstream file(entry_path, std::ios::binary);
+		if (!file) {
+			return nullptr; // not cached yet
+		}
+
+		EntryHeader header{};
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+			|| std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version
+			|| header.mtime != mtime || header.content_hash != content_hash || header.path_length != source_path.size()) {
+			return nullptr; // stale, or another path's entry
+		}
+
+		std::string cached_path(header.path_length, '\0');
+		if (!file.read(cached_path.data(), header.path_length) || cached_path != source_path) {
+			return nullptr;
+		}
+
+		SDL_Surface* surface = SDL_CreateSurface(static_cast<int>(header.width), static_cast<int>(header.height), static_cast<SDL_PixelFormat>(header.format));
+		if (!surface) {
+			return nullptr;
+		}
+
+		if (static_cast<std::uint32_t>(surface->pitch) == header.pitch) {
+			// Same row layout, the pixels are read in one go
+			if (!file.read(static_cast<char*>(surface->pixels), static_cast<std::streamsize>(header.pitch) * header.height)) {
+				SDL_DestroySurface(surface);
+				return nullptr;
+			}
+		}
+		else {
+			const std::size_t row_bytes = std::min<std::size_t>(header.pitch, static_cast<std::size_t>(surface->pitch));
+			std::string skipped(header.pitch - row_bytes, '\0');
+
+			for (std::uint32_t y = 0; y < header.height; ++y) {
+				char* row = static_cast<char*>(surface->pixels) + static_cast<std::size_t>(y) * surface->pitch;
+
+				if (!file.read(row, static_cast<std::streamsize>(row_bytes)) || !file.read(skipped.data(), static_cast<std::streamsize>(skipped.size()))) {
+					SDL_DestroySurface(surface);
+					return nullptr;
+				}
+			}
+		}
+
+		return surface;
+	}
+
+	bool TextureDiskCache::store(const std::string& source_path, std::uint64_t mtime, std::uint64_t content_hash, const SDL_Surface* surface) const {
+		std::filesystem::path entry_path = get_entry_path(source_path);
+		if (entry_path.empty() || !surface || !surface->pixels) {
+			return false;
+		}
+
+		EntryHeader header{};
+		std::memcpy(header.magic, Magic, sizeof(Magic));
+		header.version = Version;
+		header.mtime = mtime;
+		header.content_hash = content_hash;
+		header.format = static_cast<std::uint32_t>(surface->format);
+		header.width = static_cast<std::uint32_t>(surface->w);
+		header.height = static_cast<std::uint32_t>(surface->h);
+		header.pitch = static_cast<std::uint32_t>(surface->pitch);
+		header.path_length = static_cast<std::uint32_t>(source_path.size());
+
+		// Written to a temporary file first, so a reader (or a crash) never sees half an entry
+		std::ostringstream suffix;
+		suffix << ".tmp" << std::this_thread::get_id();
+		std::filesystem::path temp_path = entry_path;
+		temp_path += suffix.str();
+
+		{
+			std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+			if (!file) {
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(source_path.data(), static_cast<std::streamsize>(source_path.size()));
+			file.write(static_cast<const char*>(surface->pixels), static_cast<std::streamsize>(header.pitch) * header.height);
+
+			if (!file) {
+				file.close();
+				std::error_code ec;
+				std::filesystem::remove(temp_path, ec);
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp_path, entry_path, ec);
+
+		if (ec) {
+			std::filesystem::remove(temp_path, ec);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::filesystem::path TextureDiskCache::get_entry_path(const std::string& source_path) const {
+		std::lock_guard<std::mutex> lock(directory_mutex);
+
+		if (directory.empty()) {
+			return {};
+		}
+
+		char name[32];
+		std::snprintf(name, sizeof(name), "%016llx.pftc",
+			static_cast<unsigned long long>(hash_data(reinterpret_cast<const unsigned char*>(source_path.data()), source_path.size())));
+
+		return directory / name;
+	}
+}
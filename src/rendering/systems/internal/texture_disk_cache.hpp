@@ -0,0 +1,49 @@
+#pragma once
+
+#include <SDL3/SDL_surface.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+
+namespace penguin::internal::rendering::systems {
+
+	// Decoded images stored on disk, so later runs skip the image decoder. One file per source path:
+	//
+	//   header   magic "PFTC", u32 version, u64 source mtime, u64 source content hash,
+	//            u32 pixel format, u32 width, u32 height, u32 pitch, u32 path length
+	//   path     the source path, to reject the (rare) file name collisions
+	//   pixels   height * pitch bytes, already in the renderer's texture format
+	//
+	// The cache is local to the machine, so it is written in native byte order. An entry whose mtime or content hash
+	// no longer matches its source is a miss, and is overwritten by the next store().
+	class TextureDiskCache {
+	public:
+		static constexpr char Magic[4] = { 'P', 'F', 'T', 'C' };
+		static constexpr std::uint32_t Version = 1;
+
+		TextureDiskCache() = default;
+
+		// Copy & move (including assigment) not allowed
+
+		TextureDiskCache(const TextureDiskCache&) = delete;
+		TextureDiskCache& operator=(const TextureDiskCache&) = delete;
+		TextureDiskCache(TextureDiskCache&&) noexcept = delete;
+		TextureDiskCache& operator=(TextureDiskCache&&) noexcept = delete;
+
+		bool set_directory(const std::string& path); // creates the directory if needed, an empty path disables the cache
+		bool is_enabled() const;
+
+		// Safe to call from any thread
+
+		SDL_Surface* load(const std::string& source_path, std::uint64_t mtime, std::uint64_t content_hash) const; // nullptr on a miss
+		bool store(const std::string& source_path, std::uint64_t mtime, std::uint64_t content_hash, const SDL_Surface* surface) const;
+
+	private:
+		std::filesystem::path get_entry_path(const std::string& source_path) const; // empty if the cache is disabled
+
+		mutable std::mutex directory_mutex;
+		std::filesystem::path directory;
+	};
+}
@@ -1,24 +1,156 @@
 #include <rendering/systems/internal/texture_loader_impl.hpp>
 
+#include <SDL3_image/SDL_image.h>
+
+#include <mutex>
+
 namespace penguin::internal::rendering::systems {
 
-    // WORKS ONLY ON SINGLE THREAD
+    TextureLoaderImpl::TextureLoaderImpl() : texture_cache([this](const std::uint64_t& cache_key) { forget_paths(cache_key); }) {}
+
     std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoaderImpl::load(NativeRendererPtr renderer, const char* path) {
-        std::string path_str(path);
+        if (std::shared_ptr<penguin::rendering::primitives::Texture> cached = find(path)) {
+            return cached;
+        }
+
+        // Hashing the file is far cheaper than decoding it, so an identical image under another path is found before decoding
+        FileData file = read_file(path);
+        if (!file) {
+            return std::make_shared<penguin::rendering::primitives::Texture>(renderer, path); // logs why the file cannot be loaded, not cached
+        }
+
+        const std::uint64_t content_hash = hash_data(file->data(), file->size());
+        const penguin::rendering::primitives::AlphaMode mode = alpha_mode.load(std::memory_order_relaxed);
+
+        // A texture that is already cached (or being loaded by another thread) is shared instead of loaded again
+        std::shared_ptr<penguin::rendering::primitives::Texture> texture = texture_cache.get_or_load(get_cache_key(content_hash, mode), [&]() {
+            std::unique_ptr<SDL_Surface, void(*)(SDL_Surface*)> surface(IMG_Load_IO(SDL_IOFromConstMem(file->data(), file->size()), true), &SDL_DestroySurface);
+
+            auto new_texture = surface ? std::make_shared<penguin::rendering::primitives::Texture>(renderer, NativeSurfacePtr{ surface.get() }, mode)
+                : std::make_shared<penguin::rendering::primitives::Texture>(renderer, path, mode);
+
+            return CacheLoad<std::shared_ptr<penguin::rendering::primitives::Texture>>{ new_texture, get_texture_bytes(*new_texture), new_texture->is_valid() }; // a failed decode is retried next time
+        });
+
+        if (texture->is_valid()) {
+            remember_path(path, content_hash);
+        }
+
+        return texture;
+    }
+
+    std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoaderImpl::load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded) {
+        return load(renderer, path, decoded, hash_pixels(decoded.as<SDL_Surface>()));
+    }
+
+    std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoaderImpl::load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded, std::uint64_t content_hash) {
+        const penguin::rendering::primitives::AlphaMode mode = alpha_mode.load(std::memory_order_relaxed);
+
+        // If the contents were loaded in the meantime (e.g. synchronously while the image was decoding), the cached texture is kept
+        std::shared_ptr<penguin::rendering::primitives::Texture> texture = texture_cache.get_or_load(get_cache_key(content_hash, mode), [&]() {
+            auto new_texture = std::make_shared<penguin::rendering::primitives::Texture>(renderer, decoded, mode);
+            return CacheLoad<std::shared_ptr<penguin::rendering::primitives::Texture>>{ new_texture, get_texture_bytes(*new_texture), new_texture->is_valid() };
+        });
+
+        if (texture->is_valid()) {
+            remember_path(path, content_hash);
+        }
+
+        return texture;
+    }
+
+    std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoaderImpl::find(const char* path) const {
+        std::uint64_t content_hash;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(path_mutex);
+
+            auto it = path_hashes.find(path);
+            if (it == path_hashes.end()) {
+                return nullptr;
+            }
+
+            content_hash = it->second;
+        }
+
+        return texture_cache.find(get_cache_key(content_hash, alpha_mode.load(std::memory_order_relaxed))); // nullptr if the texture was evicted since
+    }
+
+    void TextureLoaderImpl::remember_path(const char* path, std::uint64_t content_hash) {
+        std::unique_lock<std::shared_mutex> lock(path_mutex);
+
+        auto [it, inserted] = path_hashes.try_emplace(path, content_hash);
+        if (!inserted) {
+            if (it->second == content_hash) {
+                return;
+            }
+
+            // A file that changed on disk maps to its new contents
+            std::vector<std::string>& old_paths = hash_paths[it->second];
+            std::erase(old_paths, it->first);
+            if (old_paths.empty()) {
+                hash_paths.erase(it->second);
+            }
+
+            it->second = content_hash;
+        }
+
+        hash_paths[content_hash].push_back(it->first);
+    }
+
+    void TextureLoaderImpl::forget_paths(std::uint64_t cache_key) {
+        using penguin::rendering::primitives::AlphaMode;
+
+        // The key is one alpha mode's texture; a path whose other mode is still cached is simply looked up again on its next load
+        std::unique_lock<std::shared_mutex> lock(path_mutex);
+
+        for (AlphaMode mode : { AlphaMode::Straight, AlphaMode::Premultiplied }) {
+            const std::uint64_t content_hash = get_cache_key(cache_key, mode); // the mixing is its own inverse
 
-        auto it = texture_cache.find(path_str);
-        if (it != texture_cache.end()) {
-            // Found in cache, return the existing shared_ptr
-            return it->second;
+            auto it = hash_paths.find(content_hash);
+            if (it == hash_paths.end()) {
+                continue;
+            }
+
+            for (const std::string& path : it->second) {
+                path_hashes.erase(path);
+            }
+
+            hash_paths.erase(it);
         }
+    }
 
-        // Not found in cache, load it
-        std::shared_ptr<penguin::rendering::primitives::Texture> new_texture = std::make_shared<penguin::rendering::primitives::Texture>(renderer, path);
+    std::uint64_t TextureLoaderImpl::hash_pixels(const SDL_Surface* surface) {
+        if (!surface || !surface->pixels) {
+            return 0;
+        }
 
-        // Add to cache
-        texture_cache[path_str] = new_texture; // NOTE: Only works on a single thread
+        // Size and format first, so identical bytes in different layouts do not match
+        const std::uint32_t layout[3] = { static_cast<std::uint32_t>(surface->w), static_cast<std::uint32_t>(surface->h), static_cast<std::uint32_t>(surface->format) };
+        std::uint64_t hash = hash_data(reinterpret_cast<const unsigned char*>(layout), sizeof(layout));
+
+        // Row by row, the padding at the end of each row is not part of the image
+        const std::size_t row_bytes = static_cast<std::size_t>(surface->w) * SDL_BYTESPERPIXEL(surface->format);
+
+        for (int y = 0; y < surface->h; ++y) {
+            const unsigned char* row = static_cast<const unsigned char*>(surface->pixels) + static_cast<std::size_t>(y) * surface->pitch;
+            hash ^= hash_data(row, row_bytes) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+        }
+
+        return hash;
+    }
+
+    std::uint64_t TextureLoaderImpl::get_cache_key(std::uint64_t content_hash, penguin::rendering::primitives::AlphaMode mode) {
+        return mode == penguin::rendering::primitives::AlphaMode::Premultiplied ? content_hash ^ 0x9e3779b97f4a7c15ull : content_hash;
+    }
+
+    std::size_t TextureLoaderImpl::get_texture_bytes(const penguin::rendering::primitives::Texture& texture) {
+        if (!texture.is_valid()) {
+            return 0;
+        }
 
-        return new_texture;
+        SDL_Texture* native = texture.get_native_ptr().as<SDL_Texture>();
+        return static_cast<std::size_t>(native->w) * static_cast<std::size_t>(native->h) * SDL_BYTESPERPIXEL(native->format);
     }
 
-}
\ No newline at end of file
+}
@@ -3,22 +3,34 @@
 #include <penguin_framework/common/native_types.hpp>
 
 #include <penguin_framework/rendering/primitives/texture.hpp>
+#include <rendering/systems/internal/sharded_cache.hpp>
+#include <rendering/systems/internal/file_io.hpp>
 #include <error/internal/internal_error.hpp>
 
 #include <SDL3/SDL_render.h>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <shared_mutex>
 #include <string>
 
 namespace penguin::internal::rendering::systems {
 
 	struct TextureLoaderImpl {
 
-		std::unordered_map<std::string, std::shared_ptr<penguin::rendering::primitives::Texture>> texture_cache;
+		// Textures are cached by a hash of their contents, so the same image shipped under several paths is uploaded once.
+		// The paths only map to a content hash and hold no reference, so eviction still sees every texture's real users.
+		// Evicting a texture forgets the paths that led to it, so the map does not outgrow the cache.
+		ShardedCache<std::uint64_t, std::shared_ptr<penguin::rendering::primitives::Texture>> texture_cache; // safe to use from several threads
+		std::unordered_map<std::string, std::uint64_t> path_hashes;
+		std::unordered_map<std::uint64_t, std::vector<std::string>> hash_paths; // the reverse, so an eviction only visits its own paths
+		mutable std::shared_mutex path_mutex;
+		std::atomic<penguin::rendering::primitives::AlphaMode> alpha_mode{ penguin::rendering::primitives::AlphaMode::Straight }; // of the textures loaded from now on
 
-		TextureLoaderImpl() = default;
+		TextureLoaderImpl();
 
 		// Copy & move (including assigment) not allowed
 
@@ -29,5 +41,16 @@ namespace penguin::internal::rendering::systems {
 
 		// Load functions
 		std::shared_ptr<penguin::rendering::primitives::Texture> load(NativeRendererPtr renderer, const char* path);
+		std::shared_ptr<penguin::rendering::primitives::Texture> load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded);
+		std::shared_ptr<penguin::rendering::primitives::Texture> load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded, std::uint64_t content_hash);
+		std::shared_ptr<penguin::rendering::primitives::Texture> find(const char* path) const;
+
+	private:
+		void remember_path(const char* path, std::uint64_t content_hash);
+		void forget_paths(std::uint64_t cache_key);
+
+		static std::uint64_t hash_pixels(const SDL_Surface* surface); // for surfaces decoded without their file at hand
+		static std::uint64_t get_cache_key(std::uint64_t content_hash, penguin::rendering::primitives::AlphaMode mode); // the same image in each alpha mode is its own texture
+		static std::size_t get_texture_bytes(const penguin::rendering::primitives::Texture& texture); // width * height * bytes per pixel
 	};
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <rendering/systems/internal/worker_pool.hpp>
+
+#include <algorithm>
+
+namespace penguin::internal::rendering::systems {
+
+	WorkerPool::WorkerPool(std::size_t p_thread_count) : thread_count(std::max<std::size_t>(p_thread_count, 1)), stopping(false) {}
+
+	WorkerPool::~WorkerPool() {
+		shutdown();
+	}
+
+	void WorkerPool::submit(std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(jobs_mutex);
+
+			if (stopping) {
+				return;
+			}
+
+			jobs.push_back(std::move(job));
+
+			if (threads.empty()) { // start lazily
+				threads.reserve(thread_count);
+				for (std::size_t i = 0; i < thread_count; ++i) {
+					threads.emplace_back(&WorkerPool::run, this);
+				}
+			}
+		}
+
+		jobs_available.notify_one();
+	}
+
+	void WorkerPool::shutdown() {
+		{
+			std::lock_guard<std::mutex> lock(jobs_mutex);
+			stopping = true;
+			jobs.clear();
+		}
+
+		jobs_available.notify_all();
+
+		for (std::thread& thread : threads) {
+			if (thread.joinable()) {
+				thread.join();
+			}
+		}
+
+		threads.clear();
+	}
+
+	std::size_t WorkerPool::get_thread_count() const {
+		return thread_count;
+	}
+
+	std::size_t WorkerPool::default_thread_count() {
+		unsigned int cores = std::thread::hardware_concurrency(); // 0 if unknown
+		return cores > 1 ? cores - 1 : 1;
+	}
+
+	void WorkerPool::run() {
+		while (true) {
+			std::function<void()> job;
+
+			{
+				std::unique_lock<std::mutex> lock(jobs_mutex);
+				jobs_available.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+				if (stopping) {
+					return;
+				}
+
+				job = std::move(jobs.front());
+				jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+}
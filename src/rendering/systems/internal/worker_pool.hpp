@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace penguin::internal::rendering::systems {
+
+	// Fixed-size pool of background threads that run submitted jobs in order of submission.
+	// The threads are only started by the first submitted job, so an unused pool costs nothing.
+	class WorkerPool {
+	public:
+		explicit WorkerPool(std::size_t p_thread_count = default_thread_count());
+		~WorkerPool();
+
+		// Copy & move (including assigment) not allowed
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		WorkerPool(WorkerPool&&) noexcept = delete;
+		WorkerPool& operator=(WorkerPool&&) noexcept = delete;
+
+		void submit(std::function<void()> job);
+		void shutdown(); // finishes the running jobs, drops the queued ones and joins the threads
+
+		std::size_t get_thread_count() const;
+
+		static std::size_t default_thread_count(); // one thread per core, leaving one for the render thread
+
+	private:
+		void run();
+
+		std::size_t thread_count;
+		std::vector<std::thread> threads;
+		std::deque<std::function<void()>> jobs;
+		std::mutex jobs_mutex;
+		std::condition_variable jobs_available;
+		bool stopping;
+	};
+}
@@ -4,14 +4,14 @@
 
 namespace penguin::rendering::systems {
 
-	TextContext::TextContext(NativeRendererPtr renderer) : pimpl_(nullptr) {
+	TextContext::TextContext(NativeRendererPtr renderer, std::size_t layout_cache_capacity) : pimpl_(nullptr) {
 
 		// Log attempt to create a sprite
 		PF_LOG_INFO("Attempting to create text context...");
 
 		if (renderer.ptr) {
 			try {
-				pimpl_ = std::make_unique<penguin::internal::rendering::systems::TextContextImpl>(renderer);
+				pimpl_ = std::make_unique<penguin::internal::rendering::systems::TextContextImpl>(renderer, layout_cache_capacity);
 				PF_LOG_INFO("Success: Text Context created successfully.");
 			}
 			catch (const penguin::internal::error::InternalError& e) {
@@ -52,6 +52,35 @@ namespace penguin::rendering::systems {
 		return is_valid();
 	}
 
+	// Shaped-text layout cache
+
+	std::size_t TextContext::get_layout_cache_size() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_layout_cache_size() called on an uninitialized or destroyed text context.");
+			return 0;
+		}
+
+		return pimpl_->layout_cache.get_size();
+	}
+
+	void TextContext::set_layout_cache_capacity(std::size_t new_capacity) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_layout_cache_capacity() called on an uninitialized or destroyed text context.");
+			return;
+		}
+
+		pimpl_->layout_cache.set_capacity(new_capacity);
+	}
+
+	void TextContext::clear_layout_cache() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("clear_layout_cache() called on an uninitialized or destroyed text context.");
+			return;
+		}
+
+		pimpl_->layout_cache.clear();
+	}
+
 	NativeTextContextPtr TextContext::get_native_ptr() const {
 		if (!is_valid()) {
 			PF_LOG_WARNING("get_native_ptr() called on an uninitialized or destroyed text context.");
@@ -55,4 +55,87 @@ namespace penguin::rendering::systems {
 
 		return pimpl_->load(renderer, path);
 	}
+
+	std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoader::load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load() called on an uninitialized or destroyed texture loader.");
+			return nullptr;
+		}
+
+		return pimpl_->load(renderer, path, decoded);
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoader::load(NativeRendererPtr renderer, const char* path, NativeSurfacePtr decoded, std::uint64_t content_hash) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("load() called on an uninitialized or destroyed texture loader.");
+			return nullptr;
+		}
+
+		return pimpl_->load(renderer, path, decoded, content_hash);
+	}
+
+	std::shared_ptr<penguin::rendering::primitives::Texture> TextureLoader::find(const char* path) const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("find() called on an uninitialized or destroyed texture loader.");
+			return nullptr;
+		}
+
+		return pimpl_->find(path);
+	}
+
+	void TextureLoader::set_alpha_mode(primitives::AlphaMode mode) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_alpha_mode() called on an uninitialized or destroyed texture loader.");
+			return;
+		}
+
+		pimpl_->alpha_mode.store(mode, std::memory_order_relaxed);
+	}
+
+	primitives::AlphaMode TextureLoader::get_alpha_mode() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_alpha_mode() called on an uninitialized or destroyed texture loader.");
+			return primitives::AlphaMode::Straight;
+		}
+
+		return pimpl_->alpha_mode.load(std::memory_order_relaxed);
+	}
+
+	// Memory budget
+
+	void TextureLoader::set_memory_budget(std::size_t bytes) {
+		if (!is_valid()) {
+			PF_LOG_WARNING("set_memory_budget() called on an uninitialized or destroyed texture loader.");
+			return;
+		}
+
+		pimpl_->texture_cache.set_budget(bytes);
+	}
+
+	std::size_t TextureLoader::get_memory_budget() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_memory_budget() called on an uninitialized or destroyed texture loader.");
+			return 0;
+		}
+
+		return pimpl_->texture_cache.get_budget();
+	}
+
+	void TextureLoader::trim() {
+		if (!is_valid()) {
+			PF_LOG_WARNING("trim() called on an uninitialized or destroyed texture loader.");
+			return;
+		}
+
+		pimpl_->texture_cache.evict_unused();
+	}
+
+	CacheStats TextureLoader::get_stats() const {
+		if (!is_valid()) {
+			PF_LOG_WARNING("get_stats() called on an uninitialized or destroyed texture loader.");
+			return CacheStats{};
+		}
+
+		return pimpl_->texture_cache.get_stats();
+	}
 }
@@ -0,0 +1,201 @@
+#include <penguin_framework/logger/logger.hpp>
+#include <logger/internal/binary_log.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using penguin::log::Logger;
+using penguin::log::LogArgs;
+using penguin::log::LogLevel;
+using penguin::log::LogSite;
+using penguin::internal::log::BinaryLogReader;
+using penguin::internal::log::BinaryLogWriter;
+using penguin::internal::log::DecodedLogEvent;
+using penguin::internal::log::render_log_format;
+
+class BinaryLogTestFixture : public ::testing::Test {
+protected:
+    std::string log_path = (std::filesystem::temp_directory_path() / "penguin_binary_log_test.pflog").string();
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(log_path, ec);
+    }
+
+    template <typename... Args>
+    static LogArgs pack(const Args&... args) {
+        LogArgs packed;
+        (packed.add(args), ...);
+        return packed;
+    }
+};
+
+// Formatting
+
+TEST_F(BinaryLogTestFixture, RenderLogFormat_WithEachArgumentType_ReplacesPlaceholders) {
+    // Arrange
+    LogArgs args = pack(-42, 7u, 0.5, true, "text", std::string("owned"));
+
+    // Act
+    std::string text = render_log_format("{} {} {} {} {} {}", args.get_data(), args.get_size());
+
+    // Assert
+    EXPECT_EQ("-42 7 0.5 true text owned", text);
+}
+
+TEST_F(BinaryLogTestFixture, RenderLogFormat_WithEscapedBracesAndMissingArguments_KeepsThem) {
+    // Arrange
+    LogArgs args = pack(1);
+
+    // Act
+    std::string text = render_log_format("{{{}}} {}", args.get_data(), args.get_size());
+
+    // Assert
+    EXPECT_EQ("{1} {}", text);
+}
+
+TEST_F(BinaryLogTestFixture, RenderLogFormat_WithNullCString_WritesNull) {
+    // Arrange
+    const char* missing = nullptr;
+    LogArgs args = pack(missing);
+
+    // Act
+    std::string text = render_log_format("name: {}", args.get_data(), args.get_size());
+
+    // Assert
+    EXPECT_EQ("name: (null)", text);
+}
+
+TEST_F(BinaryLogTestFixture, Add_WithStringLongerThanCapacity_Truncates) {
+    // Arrange
+    std::string long_text(LogArgs::Capacity * 2, 'a');
+
+    // Act
+    LogArgs args = pack(long_text);
+
+    // Assert
+    EXPECT_EQ(LogArgs::Capacity, args.get_size());
+}
+
+// Writing & reading
+
+TEST_F(BinaryLogTestFixture, Next_AfterWritingEvents_DecodesThemInOrder) {
+    // Arrange
+    static const LogSite site{ "Loaded {} in {} ms", LogLevel::Info, std::source_location::current() };
+
+    BinaryLogWriter writer;
+    ASSERT_TRUE(writer.open(log_path.c_str()));
+
+    LogArgs first = pack("player.png", 12);
+    LogArgs second = pack("enemy.png", 3);
+    writer.write_event(site, 1000, first.get_data(), first.get_size());
+    writer.write_event(site, 2000, second.get_data(), second.get_size());
+    writer.close();
+
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(log_path.c_str()));
+
+    DecodedLogEvent a;
+    DecodedLogEvent b;
+    DecodedLogEvent c;
+
+    // Act
+    bool has_a = reader.next(a);
+    bool has_b = reader.next(b);
+    bool has_c = reader.next(c);
+
+    // Assert
+    ASSERT_TRUE(has_a);
+    ASSERT_TRUE(has_b);
+    EXPECT_FALSE(has_c);
+    EXPECT_FALSE(reader.is_truncated());
+    EXPECT_EQ("Loaded player.png in 12 ms", a.message);
+    EXPECT_EQ("Loaded enemy.png in 3 ms", b.message);
+    EXPECT_EQ(1000u, a.timestamp_ns);
+    EXPECT_EQ(LogLevel::Info, b.level);
+    EXPECT_EQ(static_cast<int>(site.location.line()), a.line);
+}
+
+TEST_F(BinaryLogTestFixture, Open_WithTextFile_ReturnsFalse) {
+    // Arrange
+    {
+        std::ofstream file(log_path);
+        file << "not a binary log";
+    }
+
+    BinaryLogReader reader;
+
+    // Act
+    bool opened = reader.open(log_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(opened);
+}
+
+// Logger
+
+TEST_F(BinaryLogTestFixture, OpenBinaryLog_WithFormatMacro_RecordsEntry) {
+    // Arrange
+    Logger& logger = Logger::get_instance();
+    ASSERT_TRUE(logger.open_binary_log(log_path.c_str()));
+
+    // Act
+    for (int i = 0; i < 3; ++i) {
+        PF_LOG_INFO_FMT("Frame {} took {} ms", i, 16.5);
+    }
+    logger.close_binary_log();
+
+    // Assert
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.open(log_path.c_str()));
+
+    DecodedLogEvent event;
+    int count = 0;
+    while (reader.next(event)) {
+        EXPECT_EQ("Frame " + std::to_string(count) + " took 16.5 ms", event.message);
+        ++count;
+    }
+
+    EXPECT_EQ(3, count);
+}
+
+TEST_F(BinaryLogTestFixture, ErrorFormatMacro_WithBinaryLogOpen_ReachesTheFileRightAway) {
+    // Arrange
+    Logger& logger = Logger::get_instance();
+    ASSERT_TRUE(logger.open_binary_log(log_path.c_str()));
+
+    // Act
+    PF_LOG_ERROR_FMT("Device lost after {} frames", 42);
+
+    BinaryLogReader reader;
+    bool opened = reader.open(log_path.c_str()); // read while the log is still open
+    DecodedLogEvent event;
+    bool found = opened && reader.next(event);
+    logger.close_binary_log();
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_EQ("Device lost after 42 frames", event.message);
+}
+
+TEST_F(BinaryLogTestFixture, Flush_WithBinaryLogOpen_WritesBufferedEvents) {
+    // Arrange
+    Logger& logger = Logger::get_instance();
+    ASSERT_TRUE(logger.open_binary_log(log_path.c_str()));
+    PF_LOG_INFO_FMT("Loaded {} textures", 7);
+
+    // Act
+    logger.flush();
+
+    BinaryLogReader reader;
+    bool opened = reader.open(log_path.c_str());
+    DecodedLogEvent event;
+    bool found = opened && reader.next(event);
+    logger.close_binary_log();
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_EQ("Loaded 7 textures", event.message);
+}
@@ -0,0 +1,35 @@
+#define PF_LOG_MIN_LEVEL 2 // Warning: the debug and info macros compile to nothing in this file
+#include <penguin_framework/logger/logger.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+    int count_evaluation(int& counter) {
+        return ++counter;
+    }
+}
+
+// Compile-time threshold
+
+TEST(LogMinLevelTest, DebugMacros_BelowCompileTimeLevel_DoNotEvaluateArguments) {
+    // Arrange
+    int counter = 0;
+
+    // Act
+    PF_LOG_DEBUG_FMT("Debug {}", count_evaluation(counter));
+    PF_LOG_INFO_FMT("Info {}", count_evaluation(counter));
+    PF_LOG_DEBUG(count_evaluation(counter) ? "Debug" : "");
+
+    // Assert
+    EXPECT_EQ(0, counter);
+}
+
+TEST(LogMinLevelTest, WarningMacros_AtCompileTimeLevel_AreKept) {
+    // Arrange
+    int counter = 0;
+
+    // Act
+    PF_LOG_WARNING_FMT("Warning {}", count_evaluation(counter));
+
+    // Assert
+    EXPECT_EQ(1, counter);
+}
@@ -0,0 +1,114 @@
+#include <logger/internal/log_rate_limiter.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+
+using penguin::internal::log::LogRateLimiter;
+using penguin::log::LogRateLimit;
+using namespace std::chrono_literals;
+
+class LogRateLimiterTestFixture : public ::testing::Test {
+protected:
+    LogRateLimiter limiter;
+    LogRateLimiter::Clock::time_point start = LogRateLimiter::Clock::now();
+    std::uint64_t site = 42;
+
+    void SetUp() override {
+        limiter.set_limit(LogRateLimit{ .enabled = true, .per_second = 2.0f, .burst = 3.0f, .report_interval = 1.0f });
+    }
+};
+
+// Token bucket
+
+TEST_F(LogRateLimiterTestFixture, Check_WithinBurst_WritesEveryEntry) {
+    // Act & Assert
+    for (int i = 0; i < 3; ++i) {
+        LogRateLimiter::Decision decision = limiter.check(site, start);
+        EXPECT_TRUE(decision.write);
+        EXPECT_EQ(0u, decision.suppressed);
+    }
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_PastBurst_SuppressesEntries) {
+    // Arrange
+    for (int i = 0; i < 3; ++i) {
+        limiter.check(site, start);
+    }
+
+    // Act
+    LogRateLimiter::Decision decision = limiter.check(site, start + 10ms);
+
+    // Assert
+    EXPECT_FALSE(decision.write);
+    EXPECT_EQ(0u, decision.suppressed);
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_AfterRefill_ReportsSuppressedEntries) {
+    // Arrange
+    for (int i = 0; i < 5; ++i) {
+        limiter.check(site, start); // 3 written, 2 suppressed
+    }
+
+    // Act
+    LogRateLimiter::Decision decision = limiter.check(site, start + 500ms); // one token back at 2 per second
+
+    // Assert
+    EXPECT_TRUE(decision.write);
+    EXPECT_EQ(2u, decision.suppressed);
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_WhileFloodingPastInterval_ReportsWithoutWriting) {
+    // Arrange
+    limiter.set_limit(LogRateLimit{ .enabled = true, .per_second = 0.0f, .burst = 1.0f, .report_interval = 1.0f });
+    limiter.check(site, start);
+
+    for (int i = 0; i < 100; ++i) {
+        limiter.check(site, start + 1ms * i);
+    }
+
+    // Act
+    LogRateLimiter::Decision decision = limiter.check(site, start + 1s);
+
+    // Assert
+    EXPECT_FALSE(decision.write);
+    EXPECT_EQ(101u, decision.suppressed);
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_WithDifferentSites_KeepsSeparateBuckets) {
+    // Arrange
+    for (int i = 0; i < 3; ++i) {
+        limiter.check(site, start);
+    }
+
+    // Act
+    LogRateLimiter::Decision decision = limiter.check(site + 1, start);
+
+    // Assert
+    EXPECT_TRUE(decision.write);
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_WithSiteBucket_LimitsItLikeAKeyedSite) {
+    // Arrange
+    penguin::log::LogRateBucket bucket;
+
+    for (int i = 0; i < 4; ++i) {
+        limiter.check(bucket, start); // 3 written, 1 suppressed
+    }
+
+    // Act
+    LogRateLimiter::Decision decision = limiter.check(bucket, start + 500ms);
+
+    // Assert
+    EXPECT_TRUE(decision.write);
+    EXPECT_EQ(1u, decision.suppressed);
+    EXPECT_TRUE(limiter.check(site, start).write); // the keyed site's bucket is untouched
+}
+
+TEST_F(LogRateLimiterTestFixture, Check_WhenDisabled_WritesEveryEntry) {
+    // Arrange
+    limiter.set_limit(LogRateLimit{ .enabled = false });
+
+    // Act & Assert
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(limiter.check(site, start).write);
+    }
+}
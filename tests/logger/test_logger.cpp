@@ -0,0 +1,137 @@
+#include <penguin_framework/logger/logger.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using penguin::log::Logger;
+using penguin::log::AsyncLogOptions;
+using penguin::log::LogOverflowPolicy;
+using penguin::log::LogLevel;
+
+// Synchronous logging
+
+TEST(LoggerTest, Error_WhenLogged_IsKeptAsLastError) {
+    // Arrange
+    Logger logger;
+
+    // Act
+    logger.error("Test error");
+
+    // Assert
+    EXPECT_TRUE(logger.has_error());
+    EXPECT_STREQ("Test error", logger.get_last_error_message());
+}
+
+TEST(LoggerTest, Error_PastRateLimit_IsStillKeptAsLastError) {
+    // Arrange
+    Logger logger;
+    logger.set_rate_limit({ .enabled = true, .per_second = 0.0f, .burst = 1.0f });
+
+    // Act
+    for (int i = 0; i < 5; ++i) {
+        std::string message = "Load failed #" + std::to_string(i);
+        logger.error(message.c_str()); // one call site, only the first entry is written
+    }
+
+    // Assert
+    EXPECT_STREQ("Load failed #4", logger.get_last_error_message());
+}
+
+// Level filtering
+
+TEST(LoggerTest, IsEnabled_WithDefaultMinLevel_AcceptsEveryLevel) {
+    // Arrange
+    Logger logger;
+
+    // Act & Assert
+    EXPECT_EQ(LogLevel::Debug, logger.get_min_level());
+    EXPECT_TRUE(logger.is_enabled(LogLevel::Debug));
+    EXPECT_TRUE(logger.is_enabled(LogLevel::Error));
+}
+
+TEST(LoggerTest, SetMinLevel_WithWarning_FiltersLowerLevels) {
+    // Arrange
+    Logger logger;
+
+    // Act
+    logger.set_min_level(LogLevel::Warning);
+
+    // Assert
+    EXPECT_FALSE(logger.is_enabled(LogLevel::Debug));
+    EXPECT_FALSE(logger.is_enabled(LogLevel::Info));
+    EXPECT_TRUE(logger.is_enabled(LogLevel::Warning));
+}
+
+// Asynchronous logging
+
+TEST(LoggerTest, SetAsync_WithEnabled_SwitchesMode) {
+    // Arrange
+    Logger logger;
+
+    // Act
+    logger.set_async(true);
+    bool async = logger.is_async();
+    logger.set_async(false);
+
+    // Assert
+    EXPECT_TRUE(async);
+    EXPECT_FALSE(logger.is_async());
+}
+
+TEST(LoggerTest, Error_InAsyncMode_IsKeptAsLastErrorRightAway) {
+    // Arrange
+    Logger logger;
+    logger.set_async(true);
+
+    // Act
+    logger.error("Queued error");
+
+    // Assert
+    EXPECT_TRUE(logger.has_error());
+    EXPECT_STREQ("Queued error", logger.get_last_error_message());
+}
+
+TEST(LoggerTest, Flush_WithBlockPolicy_WritesEveryEntryWithoutDrops) {
+    // Arrange
+    Logger logger;
+    logger.set_rate_limit({ .enabled = false }); // every entry reaches the queue
+    logger.set_async(true, AsyncLogOptions{ .capacity = 4, .overflow = LogOverflowPolicy::Block });
+
+    std::vector<std::thread> producers;
+
+    // Act
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([&logger]() {
+            for (int i = 0; i < 250; ++i) {
+                logger.debug("Async test entry");
+            }
+        });
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    logger.flush();
+
+    // Assert
+    EXPECT_EQ(0u, logger.get_dropped_count());
+}
+
+TEST(LoggerTest, Debug_WithDropPolicyAndFullQueue_CountsDroppedEntries) {
+    // Arrange
+    Logger logger;
+    logger.set_rate_limit({ .enabled = false });
+    logger.set_async(true, AsyncLogOptions{ .capacity = 2, .overflow = LogOverflowPolicy::Drop });
+
+    // Act
+    for (int i = 0; i < 10000; ++i) {
+        logger.debug("Async test entry"); // far faster than the writer thread writes them
+    }
+
+    logger.flush();
+
+    // Assert
+    EXPECT_GT(logger.get_dropped_count(), 0u);
+}
@@ -0,0 +1,118 @@
+#include <logger/internal/mpsc_ring.hpp>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using penguin::internal::log::MpscRing;
+
+// Construction
+
+TEST(MpscRingTest, Constructor_WithCapacity_RoundsUpToPowerOfTwo) {
+    // Act
+    MpscRing<int> ring(100);
+
+    // Assert
+    EXPECT_EQ(128u, ring.get_capacity());
+}
+
+// Pushing & popping
+
+TEST(MpscRingTest, TryPop_AfterPushes_ReturnsValuesInOrder) {
+    // Arrange
+    MpscRing<std::string> ring(4);
+    std::string first = "first";
+    std::string second = "second";
+    ASSERT_TRUE(ring.try_push(first));
+    ASSERT_TRUE(ring.try_push(second));
+
+    // Act
+    std::optional<std::string> a = ring.try_pop();
+    std::optional<std::string> b = ring.try_pop();
+    std::optional<std::string> c = ring.try_pop();
+
+    // Assert
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    EXPECT_EQ("first", *a);
+    EXPECT_EQ("second", *b);
+    EXPECT_FALSE(c);
+}
+
+TEST(MpscRingTest, TryPush_WhenFull_ReturnsFalseAndKeepsValue) {
+    // Arrange
+    MpscRing<std::string> ring(2);
+    std::string value = "queued";
+    ASSERT_TRUE(ring.try_push(value));
+    value = "queued";
+    ASSERT_TRUE(ring.try_push(value));
+
+    std::string overflow = "overflow";
+
+    // Act
+    bool pushed = ring.try_push(overflow);
+
+    // Assert
+    EXPECT_FALSE(pushed);
+    EXPECT_EQ("overflow", overflow);
+}
+
+TEST(MpscRingTest, TryPush_AfterPop_ReusesSlot) {
+    // Arrange
+    MpscRing<int> ring(2);
+    int value = 1;
+    ASSERT_TRUE(ring.try_push(value));
+    ASSERT_TRUE(ring.try_push(value));
+    ASSERT_TRUE(ring.try_pop());
+
+    // Act
+    value = 3;
+    bool pushed = ring.try_push(value);
+
+    // Assert
+    EXPECT_TRUE(pushed);
+}
+
+// Concurrency
+
+TEST(MpscRingTest, TryPush_FromSeveralThreads_DeliversEveryValueInProducerOrder) {
+    // Arrange
+    constexpr int Producers = 4;
+    constexpr int Per_Producer = 5000;
+    MpscRing<int> ring(256);
+    std::vector<std::thread> producers;
+
+    // Act
+    for (int p = 0; p < Producers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (int i = 0; i < Per_Producer; ++i) {
+                int value = p * Per_Producer + i;
+                while (!ring.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> next(Producers, 0);
+    int received = 0;
+    bool in_order = true;
+
+    while (received < Producers * Per_Producer) {
+        if (std::optional<int> value = ring.try_pop()) {
+            const int producer = *value / Per_Producer;
+            in_order = in_order && (*value % Per_Producer == next[producer]);
+            ++next[producer];
+            ++received;
+        }
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    // Assert
+    EXPECT_TRUE(in_order);
+    EXPECT_FALSE(ring.try_pop());
+}
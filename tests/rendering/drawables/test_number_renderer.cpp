@@ -0,0 +1,147 @@
+#include <penguin_framework/window/window.hpp>
+#include <penguin_framework/rendering/renderer.hpp>
+#include <penguin_framework/rendering/drawables/number_renderer.hpp>
+#include <penguin_framework/penguin_init.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include <common/test_helpers.hpp>
+
+using penguin::window::Window;
+using penguin::window::WindowFlags;
+using penguin::rendering::Renderer;
+using penguin::rendering::drawables::NumberRenderer;
+using penguin::rendering::primitives::Font;
+using penguin::math::Vector2;
+using penguin::math::Vector2i;
+using penguin::math::Colour;
+
+class NumberRendererTestFixture : public ::testing::Test {
+protected:
+    std::unique_ptr<Window> window_ptr;
+    std::unique_ptr<Renderer> renderer_ptr;
+    std::shared_ptr<Font> font_ptr;
+    std::unique_ptr<NumberRenderer> number_ptr;
+    std::unique_ptr<NumberRenderer> invalid_number_ptr;
+
+    const char* asset_name = "pixelify_sans_regular.ttf";
+    std::string abs_path = std::filesystem::absolute(get_test_asset_path(asset_name)).string();
+
+    void SetUp() override {
+        penguin::InitOptions options{ .headless_mode = true };
+        ASSERT_TRUE(penguin::init(options));
+
+        window_ptr = std::make_unique<Window>("Test Window", Vector2i(640, 480), WindowFlags::Hidden);
+        ASSERT_TRUE(window_ptr->is_valid()); // window should be OPEN and VALID
+
+        renderer_ptr = std::make_unique<Renderer>(*window_ptr, "software");
+        ASSERT_TRUE(renderer_ptr->is_valid());
+
+        font_ptr = std::make_shared<Font>(abs_path.c_str());
+        ASSERT_TRUE(font_ptr->is_valid());
+
+        number_ptr = std::make_unique<NumberRenderer>(renderer_ptr->get_native_ptr(), font_ptr);
+        ASSERT_TRUE(number_ptr->is_valid());
+
+        invalid_number_ptr = std::make_unique<NumberRenderer>(renderer_ptr->get_native_ptr(), nullptr);
+        ASSERT_FALSE(invalid_number_ptr->is_valid());
+    }
+
+    void TearDown() override {
+        // Manually destroy resources in reverse order
+        invalid_number_ptr.reset();
+        number_ptr.reset();
+        font_ptr.reset();
+        renderer_ptr.reset();
+        window_ptr.reset();
+
+        // Safe to quit
+        penguin::quit();
+    }
+};
+
+TEST_F(NumberRendererTestFixture, CreatedNumberRenderer_HasDefault_PropertiesSet) {
+    // Arrange
+    Vector2 expected_position = Vector2::Zero;
+    Colour expected_colour = Colours::White;
+
+    // Act (done via SetUp)
+
+    // Assert
+    EXPECT_TRUE(number_ptr->is_valid());
+    EXPECT_STREQ("0", number_ptr->get_string());
+    EXPECT_EQ(expected_position, number_ptr->get_position());
+    EXPECT_EQ(expected_colour, number_ptr->get_colour());
+    EXPECT_NE(number_ptr->get_native_ptr().ptr, nullptr);
+}
+
+// Formatting
+
+TEST_F(NumberRendererTestFixture, SetInt_FormatsValue) {
+    // Arrange
+    std::int64_t value = -123456;
+
+    // Act
+    number_ptr->set_int(value);
+
+    // Assert
+    EXPECT_STREQ("-123456", number_ptr->get_string());
+    EXPECT_GT(number_ptr->get_size().x, 0.0f);
+}
+
+TEST_F(NumberRendererTestFixture, SetFloat_FormatsValueWithPrecision) {
+    // Arrange
+    double value = 59.941;
+
+    // Act
+    number_ptr->set_float(value, 1);
+
+    // Assert
+    EXPECT_STREQ("59.9", number_ptr->get_string());
+}
+
+TEST_F(NumberRendererTestFixture, SetInt_WithLongerValue_IncreasesWidth) {
+    // Arrange
+    number_ptr->set_int(1);
+    float short_width = number_ptr->get_size().x;
+
+    // Act
+    number_ptr->set_int(1000000);
+    float long_width = number_ptr->get_size().x;
+
+    // Assert
+    EXPECT_GT(long_width, short_width);
+}
+
+// Drawing
+
+TEST_F(NumberRendererTestFixture, DrawNumber_WithValidNumberRenderer_RendererRemainsValid) {
+    // Arrange
+    number_ptr->set_position(Vector2(10.0f, 10.0f));
+    number_ptr->set_float(144.0, 0);
+
+    // Act
+    renderer_ptr->draw_number(*number_ptr);
+
+    // Assert
+    EXPECT_TRUE(renderer_ptr->is_valid());
+}
+
+// Invalid NumberRenderer Operations
+
+TEST_F(NumberRendererTestFixture, InvalidNumberRenderer_OperationsLog_Warnings) {
+    // Arrange (done via SetUp)
+
+    // Act & Assert
+    EXPECT_FALSE(static_cast<bool>(*invalid_number_ptr));
+
+    // These should all log warnings but not crash
+    invalid_number_ptr->set_int(10);
+    invalid_number_ptr->set_float(1.5);
+    invalid_number_ptr->set_position(Vector2(10.0f, 10.0f));
+    renderer_ptr->draw_number(*invalid_number_ptr);
+
+    EXPECT_STREQ("", invalid_number_ptr->get_string());
+    EXPECT_EQ(invalid_number_ptr->get_native_ptr().ptr, nullptr);
+}
@@ -15,6 +15,7 @@ using penguin::rendering::Renderer;
 using penguin::rendering::drawables::Text;
 using penguin::rendering::primitives::Font;
 using penguin::rendering::systems::TextContext;
+using penguin::rendering::primitives::TextAlignment;
 using penguin::math::Vector2;
 using penguin::math::Vector2i;
 using penguin::math::Rect2;
@@ -201,6 +202,248 @@ TEST_F(TextTestFixture, SetString_Sets_TextString) {
     EXPECT_STREQ(new_string, actual_string);
 }
 
+// Size
+
+TEST_F(TextTestFixture, GetSize_WithValidText_ReturnsNonZeroBounds) {
+    // Arrange (done via SetUp)
+
+    // Act
+    Vector2i actual_size = text_ptr->get_size();
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_valid());
+    EXPECT_GT(actual_size.x, 0);
+    EXPECT_GT(actual_size.y, 0);
+}
+
+// Layout Cache
+
+TEST_F(TextTestFixture, TextsWithSameString_ShareCachedLayout) {
+    // Arrange
+    Text other_text(*text_context_ptr, font_ptr, "Hello World!");
+
+    // Act
+    auto native_ptr = text_ptr->get_native_ptr();
+    auto other_native_ptr = other_text.get_native_ptr();
+
+    // Assert
+    EXPECT_TRUE(other_text.is_valid());
+    EXPECT_EQ(native_ptr.ptr, other_native_ptr.ptr);
+    EXPECT_EQ(text_ptr->get_size(), other_text.get_size());
+}
+
+TEST_F(TextTestFixture, SetString_WithDifferentString_UsesDifferentLayout) {
+    // Arrange
+    Text other_text(*text_context_ptr, font_ptr, "Hello World!");
+
+    // Act
+    other_text.set_string("Level 1");
+
+    // Assert
+    EXPECT_TRUE(other_text.is_valid());
+    EXPECT_NE(text_ptr->get_native_ptr().ptr, other_text.get_native_ptr().ptr);
+    EXPECT_STREQ("Level 1", other_text.get_string());
+}
+
+TEST_F(TextTestFixture, ClearLayoutCache_KeepsExistingTextValid) {
+    // Arrange
+    EXPECT_GT(text_context_ptr->get_layout_cache_size(), 0u);
+
+    // Act
+    text_context_ptr->clear_layout_cache();
+
+    // Assert
+    EXPECT_EQ(text_context_ptr->get_layout_cache_size(), 0u);
+    EXPECT_TRUE(text_ptr->is_valid());
+    EXPECT_NE(text_ptr->get_native_ptr().ptr, nullptr);
+}
+
+// Paragraph layout
+
+TEST_F(TextTestFixture, GetLines_WithNewlines_ReturnsOneLinePerParagraph) {
+    // Arrange
+    text_ptr->set_string("First\nSecond\nThird");
+
+    // Act
+    auto lines = text_ptr->get_lines();
+
+    // Assert
+    ASSERT_EQ(3u, lines.size());
+    EXPECT_EQ(0u, lines[0].offset);
+    EXPECT_EQ(5u, lines[0].length);
+    EXPECT_EQ(6u, lines[1].offset);
+    EXPECT_LT(lines[0].bounds.position.y, lines[1].bounds.position.y);
+    EXPECT_LT(lines[1].bounds.position.y, lines[2].bounds.position.y);
+}
+
+TEST_F(TextTestFixture, SetWrapWidth_WithNarrowWidth_BreaksAtWordBoundaries) {
+    // Arrange
+    text_ptr->set_string("the quick brown fox jumps over the lazy dog");
+    const int wrap_width = 80;
+
+    // Act
+    text_ptr->set_wrap_width(wrap_width);
+    auto lines = text_ptr->get_lines();
+
+    // Assert
+    EXPECT_EQ(wrap_width, text_ptr->get_wrap_width());
+    ASSERT_GT(lines.size(), 1u);
+
+    std::string str = text_ptr->get_string();
+    for (const auto& line : lines) {
+        EXPECT_LE(line.bounds.size.x, static_cast<float>(wrap_width));
+        EXPECT_NE(' ', str[line.offset]); // the spaces a line breaks on are dropped
+        EXPECT_NE(' ', str[line.offset + line.length - 1]);
+    }
+}
+
+TEST_F(TextTestFixture, GetLines_WithUnchangedLayout_ReusesCachedLines) {
+    // Arrange
+    text_ptr->set_wrap_width(40);
+    auto first = text_ptr->get_lines();
+
+    // Act
+    auto second = text_ptr->get_lines();
+
+    // Assert
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(first.size(), second.size());
+}
+
+TEST_F(TextTestFixture, SetAlignment_WithCenterAlignment_CentersLinesInWrapWidth) {
+    // Arrange
+    text_ptr->set_string("Hi");
+    text_ptr->set_wrap_width(200);
+
+    // Act
+    text_ptr->set_alignment(TextAlignment::Center);
+    auto lines = text_ptr->get_lines();
+
+    // Assert
+    EXPECT_EQ(TextAlignment::Center, text_ptr->get_alignment());
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_FLOAT_EQ((200.0f - lines[0].bounds.size.x) * 0.5f, lines[0].bounds.position.x);
+    EXPECT_EQ(200, text_ptr->get_size().x);
+}
+
+TEST_F(TextTestFixture, SetAlignment_WithCenterAlignmentAndBlankLines_GivesEmptyLinesNoWidth) {
+    // Arrange
+    text_ptr->set_string("Wide first line\n\nab\n");
+
+    // Act
+    text_ptr->set_alignment(TextAlignment::Center);
+    auto lines = text_ptr->get_lines();
+
+    // Assert
+    ASSERT_EQ(4u, lines.size());
+    const float widest = lines[0].bounds.size.x;
+    EXPECT_EQ(static_cast<int>(widest), text_ptr->get_size().x);
+    EXPECT_FLOAT_EQ(0.0f, lines[0].bounds.position.x);
+
+    for (std::size_t i : { 1u, 3u }) { // the blank paragraph and the one after the trailing newline
+        EXPECT_EQ(0u, lines[i].length);
+        EXPECT_FLOAT_EQ(0.0f, lines[i].bounds.size.x);
+        EXPECT_FLOAT_EQ(widest * 0.5f, lines[i].bounds.position.x);
+    }
+}
+
+TEST_F(TextTestFixture, SetLineSpacing_WithDoubleSpacing_IncreasesHeight) {
+    // Arrange
+    text_ptr->set_string("First\nSecond");
+    int single_height = text_ptr->get_size().y;
+
+    // Act
+    text_ptr->set_line_spacing(2.0f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(2.0f, text_ptr->get_line_spacing());
+    EXPECT_GT(text_ptr->get_size().y, single_height);
+}
+
+TEST_F(TextTestFixture, SetLineSpacing_WithNonPositiveSpacing_KeepsPreviousSpacing) {
+    // Act
+    text_ptr->set_line_spacing(0.0f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(1.0f, text_ptr->get_line_spacing());
+}
+
+// Scaled drawing
+
+TEST_F(TextTestFixture, SetScale_WithPositiveScale_KeepsUnscaledSize) {
+    // Arrange
+    Vector2i size = text_ptr->get_size();
+
+    // Act
+    text_ptr->set_scale(2.5f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(2.5f, text_ptr->get_scale());
+    EXPECT_EQ(size, text_ptr->get_size());
+}
+
+TEST_F(TextTestFixture, SetScale_WithNonPositiveScale_KeepsPreviousScale) {
+    // Act
+    text_ptr->set_scale(-1.0f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(1.0f, text_ptr->get_scale());
+}
+
+// Baking
+
+TEST_F(TextTestFixture, Bake_WithValidRenderer_MarksTextAsBaked) {
+    // Arrange
+    EXPECT_FALSE(text_ptr->is_baked());
+
+    // Act
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_valid());
+    EXPECT_TRUE(text_ptr->is_baked());
+}
+
+TEST_F(TextTestFixture, Unbake_WithBakedText_ClearsBakedState) {
+    // Arrange
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+
+    // Act
+    text_ptr->unbake();
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_valid());
+    EXPECT_FALSE(text_ptr->is_baked());
+}
+
+TEST_F(TextTestFixture, SetString_WithBakedText_StaysBaked) {
+    // Arrange
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+
+    // Act
+    text_ptr->set_string("Game Over");
+    text_ptr->set_colour(Colours::Red);
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_baked());
+    EXPECT_STREQ("Game Over", text_ptr->get_string());
+    EXPECT_EQ(Colours::Red, text_ptr->get_colour());
+}
+
+TEST_F(TextTestFixture, Bake_WithWrappedText_StaysBakedAfterLayoutChanges) {
+    // Arrange
+    text_ptr->set_string("the quick brown fox jumps over the lazy dog");
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+
+    // Act
+    text_ptr->set_wrap_width(80);
+    text_ptr->set_alignment(TextAlignment::Right);
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_baked());
+    EXPECT_GT(text_ptr->get_lines().size(), 1u);
+}
+
 // Native Pointer
 
 TEST_F(TextTestFixture, GetNativePtr_WithValidText_ReturnsNonNullPtr) {
@@ -0,0 +1,137 @@
+#include <penguin_framework/window/window.hpp>
+#include <penguin_framework/rendering/renderer.hpp>
+#include <penguin_framework/rendering/primitives/animated_texture.hpp>
+#include <penguin_framework/penguin_init.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <common/test_helpers.hpp>
+
+using penguin::window::Window;
+using penguin::window::WindowFlags;
+using penguin::rendering::Renderer;
+using penguin::rendering::primitives::AnimatedTexture;
+using penguin::rendering::primitives::AnimationFrame;
+using penguin::math::Vector2i;
+
+class AnimatedTextureTestFixture : public ::testing::Test {
+protected:
+    std::unique_ptr<Window> window_ptr;
+    std::unique_ptr<Renderer> renderer_ptr;
+
+    // 8x8, three frames shown for 100, 200 and 300 ms
+    std::string abs_path = std::filesystem::absolute(get_test_asset_path("penguin_blink.gif")).string();
+    std::string invalid_abs_path = std::filesystem::absolute(get_test_asset_path("missing.gif")).string();
+
+    void SetUp() override {
+        penguin::InitOptions options{ .headless_mode = true };
+        ASSERT_TRUE(penguin::init(options));
+
+        window_ptr = std::make_unique<Window>("Test Window", Vector2i(640, 480), WindowFlags::Hidden);
+        ASSERT_TRUE(window_ptr->is_valid()); // window should be OPEN and VALID
+
+        renderer_ptr = std::make_unique<Renderer>(*window_ptr, "software");
+        ASSERT_TRUE(renderer_ptr->is_valid());
+    }
+
+    void TearDown() override {
+        // Manually destroy resources in reverse order
+        renderer_ptr.reset();
+        window_ptr.reset();
+
+        // Safe to quit
+        penguin::quit();
+    }
+};
+
+// Construction
+
+TEST_F(AnimatedTextureTestFixture, Constructor_WithValidGif_DecodesEveryFrame) {
+    // Act
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Assert
+    EXPECT_TRUE(animation.is_valid());
+    EXPECT_EQ(3, animation.get_frame_count()); // waits for decoding
+    EXPECT_TRUE(animation.is_ready());
+    EXPECT_EQ(Vector2i(8, 8), animation.get_frame_size());
+}
+
+TEST_F(AnimatedTextureTestFixture, Constructor_WithMissingFile_CreatesInvalidTexture) {
+    // Act
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), invalid_abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(animation.is_valid());
+    EXPECT_EQ(0, animation.get_frame_count());
+}
+
+TEST_F(AnimatedTextureTestFixture, Constructor_WithNullRenderer_CreatesInvalidTexture) {
+    // Act
+    AnimatedTexture animation(NativeRendererPtr{ nullptr }, abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(animation.is_valid());
+}
+
+// Delays
+
+TEST_F(AnimatedTextureTestFixture, GetFrameDelays_WithValidGif_ReturnsDelayTable) {
+    // Arrange
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    std::span<const int> delays = animation.get_frame_delays();
+
+    // Assert
+    ASSERT_EQ(3u, delays.size());
+    EXPECT_EQ(100, delays[0]);
+    EXPECT_EQ(200, delays[1]);
+    EXPECT_EQ(300, delays[2]);
+    EXPECT_EQ(600, animation.get_duration());
+}
+
+TEST_F(AnimatedTextureTestFixture, GetFrameAt_WithTimes_FollowsDelayTable) {
+    // Arrange
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act & Assert
+    EXPECT_EQ(0, animation.get_frame_at(0));
+    EXPECT_EQ(0, animation.get_frame_at(99));
+    EXPECT_EQ(1, animation.get_frame_at(100));
+    EXPECT_EQ(2, animation.get_frame_at(599));
+    EXPECT_EQ(0, animation.get_frame_at(600)); // looped
+    EXPECT_EQ(2, animation.get_frame_at(600, false)); // held on the last frame
+}
+
+// Frames
+
+TEST_F(AnimatedTextureTestFixture, GetFrame_WithValidIndices_SharesOneAtlasPage) {
+    // Arrange
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    AnimationFrame first = animation.get_frame(0);
+    AnimationFrame last = animation.get_frame(2);
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(last);
+    EXPECT_EQ(first.texture, last.texture);
+    EXPECT_NE(first.region.position, last.region.position);
+    EXPECT_EQ(8.0f, last.region.size.x);
+    EXPECT_EQ(300, last.delay_ms);
+}
+
+TEST_F(AnimatedTextureTestFixture, GetFrame_WithOutOfRangeIndex_ReturnsEmptyFrame) {
+    // Arrange
+    AnimatedTexture animation(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    AnimationFrame frame = animation.get_frame(3);
+
+    // Assert
+    EXPECT_FALSE(frame);
+}
@@ -5,6 +5,9 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
 
 #include <common/test_helpers.hpp>
 
@@ -12,6 +15,7 @@ using penguin::window::Window;
 using penguin::window::WindowFlags;
 using penguin::rendering::Renderer;
 using penguin::rendering::primitives::Font;
+using penguin::rendering::primitives::TextMetrics;
 using penguin::math::Vector2i;
 
 class FontTestFixture : public ::testing::Test {
@@ -68,6 +72,31 @@ TEST_F(FontTestFixture, Constructor_ValidPath_CreatesFont) {
     EXPECT_FALSE(font_ptr->is_strikethrough());
 }
 
+TEST_F(FontTestFixture, Constructor_ValidMemory_CreatesFont) {
+    // Arrange
+    std::ifstream file(abs_path, std::ios::binary);
+    auto data = std::make_shared<std::vector<unsigned char>>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    float expected_size = 32.0f;
+
+    // Act
+    Font memory_font(data, expected_size);
+
+    // Assert
+    EXPECT_TRUE(memory_font.is_valid());
+    EXPECT_FLOAT_EQ(expected_size, memory_font.get_size());
+}
+
+TEST_F(FontTestFixture, Constructor_EmptyMemory_CreatesInvalidFont) {
+    // Arrange
+    auto data = std::make_shared<std::vector<unsigned char>>();
+
+    // Act
+    Font memory_font(data);
+
+    // Assert
+    EXPECT_FALSE(memory_font.is_valid());
+}
+
 // Validity
 
 TEST_F(FontTestFixture, BoolOperator_WithValidFont_ReturnsTrue) {
@@ -234,6 +263,103 @@ TEST_F(FontTestFixture, Clear_WithValidFont_ClearsFontStyles) {
 
 // Native Pointer
 
+TEST_F(FontTestFixture, SetSdf_WithValidFont_EnablesSignedDistanceFields) {
+    // Arrange
+    EXPECT_FALSE(font_ptr->is_sdf());
+
+    // Act
+    font_ptr->set_sdf(true);
+
+    // Assert
+    EXPECT_TRUE(font_ptr->is_valid());
+    EXPECT_TRUE(font_ptr->is_sdf());
+}
+
+TEST_F(FontTestFixture, Prewarm_WithDefaultCharset_CachesAsciiGlyphs) {
+    // Arrange
+    const int ascii_glyphs = 95;
+
+    // Act
+    int cached = font_ptr->prewarm();
+
+    // Assert
+    EXPECT_GT(cached, 0);
+    EXPECT_LE(cached, ascii_glyphs);
+}
+
+TEST_F(FontTestFixture, Prewarm_WithCustomCharset_CachesOnlyThoseGlyphs) {
+    // Arrange
+    const char* charset = "0123456789";
+
+    // Act
+    int cached = font_ptr->prewarm(charset);
+
+    // Assert
+    EXPECT_EQ(10, cached);
+}
+
+TEST_F(FontTestFixture, Prewarm_WithNullCharset_CachesNothing) {
+    // Act
+    int cached = font_ptr->prewarm(nullptr);
+
+    // Assert
+    EXPECT_EQ(0, cached);
+    EXPECT_TRUE(font_ptr->is_valid());
+}
+
+TEST_F(FontTestFixture, Measure_WithSingleLine_ReturnsOneLine) {
+    // Arrange
+    const char* str = "Hello";
+
+    // Act
+    TextMetrics metrics = font_ptr->measure(str);
+
+    // Assert
+    ASSERT_EQ(1u, metrics.lines.size());
+    EXPECT_GT(metrics.size.x, 0);
+    EXPECT_GT(metrics.size.y, 0);
+    EXPECT_EQ(5u, metrics.lines[0].length);
+    EXPECT_FLOAT_EQ(static_cast<float>(metrics.size.x), metrics.lines[0].bounds.size.x);
+}
+
+TEST_F(FontTestFixture, Measure_WithWrapWidth_BreaksIntoLinesWithinWidth) {
+    // Arrange
+    const char* str = "the quick brown fox jumps over the lazy dog";
+    const int wrap_width = 60;
+
+    // Act
+    TextMetrics metrics = font_ptr->measure(str, wrap_width);
+
+    // Assert
+    EXPECT_GT(metrics.lines.size(), 1u);
+    EXPECT_LE(metrics.size.x, wrap_width);
+}
+
+TEST_F(FontTestFixture, Measure_WithReusedMetrics_OverwritesPreviousResult) {
+    // Arrange
+    TextMetrics metrics;
+    font_ptr->measure("First\nSecond\nThird", 0, metrics);
+
+    // Act
+    bool res = font_ptr->measure("Single", 0, metrics);
+
+    // Assert
+    EXPECT_TRUE(res);
+    EXPECT_EQ(1u, metrics.lines.size());
+}
+
+TEST_F(FontTestFixture, Measure_WithNullString_ReturnsFalse) {
+    // Arrange
+    TextMetrics metrics;
+
+    // Act
+    bool res = font_ptr->measure(nullptr, 0, metrics);
+
+    // Assert
+    EXPECT_FALSE(res);
+    EXPECT_TRUE(metrics.lines.empty());
+}
+
 TEST_F(FontTestFixture, GetNativePtr_WithValidFont_ReturnsNonNullPtr) {
     // Arrange (done via SetUp)
 
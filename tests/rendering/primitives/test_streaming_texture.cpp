@@ -0,0 +1,169 @@
+#include <penguin_framework/window/window.hpp>
+#include <penguin_framework/rendering/renderer.hpp>
+#include <penguin_framework/rendering/primitives/streaming_texture.hpp>
+#include <penguin_framework/penguin_init.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+
+using penguin::window::Window;
+using penguin::window::WindowFlags;
+using penguin::rendering::Renderer;
+using penguin::rendering::primitives::StreamingTexture;
+using penguin::rendering::primitives::PixelBuffer;
+using penguin::rendering::primitives::Texture;
+using penguin::math::Vector2i;
+using penguin::math::Rect2i;
+
+class StreamingTextureTestFixture : public ::testing::Test {
+protected:
+    std::unique_ptr<Window> window_ptr;
+    std::unique_ptr<Renderer> renderer_ptr;
+    Vector2i texture_size = Vector2i(64, 32);
+
+    void SetUp() override {
+        penguin::InitOptions options{ .headless_mode = true };
+        ASSERT_TRUE(penguin::init(options));
+
+        window_ptr = std::make_unique<Window>("Test Window", Vector2i(640, 480), WindowFlags::Hidden);
+        ASSERT_TRUE(window_ptr->is_valid()); // window should be OPEN and VALID
+
+        renderer_ptr = std::make_unique<Renderer>(*window_ptr, "software");
+        ASSERT_TRUE(renderer_ptr->is_valid());
+    }
+
+    void TearDown() override {
+        // Manually destroy resources in reverse order
+        renderer_ptr.reset();
+        window_ptr.reset();
+
+        // Safe to quit
+        penguin::quit();
+    }
+};
+
+// Construction
+
+TEST_F(StreamingTextureTestFixture, Constructor_WithValidSize_CreatesTexture) {
+    // Act
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size);
+
+    // Assert
+    EXPECT_TRUE(streaming.is_valid());
+    EXPECT_EQ(texture_size, streaming.get_size());
+    ASSERT_NE(streaming.get_texture(), nullptr);
+    EXPECT_EQ(texture_size, streaming.get_texture()->get_size());
+}
+
+TEST_F(StreamingTextureTestFixture, Constructor_WithZeroSize_CreatesInvalidTexture) {
+    // Act
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), Vector2i(0, 16));
+
+    // Assert
+    EXPECT_FALSE(streaming.is_valid());
+    EXPECT_EQ(streaming.get_texture(), nullptr);
+}
+
+// Locking
+
+TEST_F(StreamingTextureTestFixture, Lock_WholeTexture_ExposesEveryPixel) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size);
+
+    // Act
+    PixelBuffer buffer = streaming.lock();
+
+    // Assert
+    ASSERT_TRUE(buffer);
+    EXPECT_TRUE(streaming.is_locked());
+    EXPECT_EQ(texture_size, buffer.size);
+    EXPECT_GE(buffer.pitch, texture_size.x);
+    EXPECT_EQ(static_cast<std::size_t>(texture_size.x), buffer.get_row(texture_size.y - 1).size());
+
+    std::fill(buffer.pixels.begin(), buffer.pixels.end(), 0xFF00FF00u);
+    streaming.unlock();
+    EXPECT_FALSE(streaming.is_locked());
+}
+
+TEST_F(StreamingTextureTestFixture, Lock_WhenAlreadyLocked_ReturnsEmptyBuffer) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size);
+    ASSERT_TRUE(streaming.lock());
+
+    // Act
+    PixelBuffer second = streaming.lock();
+
+    // Assert
+    EXPECT_FALSE(second);
+    streaming.unlock();
+}
+
+TEST_F(StreamingTextureTestFixture, Lock_WithRegion_ExposesOnlyThatRegion) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size, true);
+
+    // Act
+    PixelBuffer buffer = streaming.lock(Rect2i(8, 4, 16, 8));
+
+    // Assert
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(Vector2i(16, 8), buffer.size);
+    EXPECT_EQ(texture_size.x, buffer.pitch); // triple buffered frames are tightly packed
+    EXPECT_EQ(static_cast<std::size_t>(7 * texture_size.x + 16), buffer.pixels.size());
+    streaming.unlock();
+}
+
+TEST_F(StreamingTextureTestFixture, Lock_WithRegionOutsideTexture_ReturnsEmptyBuffer) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size);
+
+    // Act
+    PixelBuffer buffer = streaming.lock(Rect2i(60, 0, 16, 8));
+
+    // Assert
+    EXPECT_FALSE(buffer);
+    EXPECT_FALSE(streaming.is_locked());
+}
+
+// Triple buffering
+
+TEST_F(StreamingTextureTestFixture, Upload_WithoutPublishedFrame_ReturnsFalse) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size, true);
+
+    // Act
+    bool uploaded = streaming.upload();
+
+    // Assert
+    EXPECT_TRUE(streaming.is_triple_buffered());
+    EXPECT_FALSE(uploaded);
+}
+
+TEST_F(StreamingTextureTestFixture, Upload_AfterUnlock_UploadsFrameOnce) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size, true);
+    PixelBuffer buffer = streaming.lock();
+    std::fill(buffer.pixels.begin(), buffer.pixels.end(), 0xFFFF0000u);
+    streaming.unlock();
+
+    // Act
+    bool first = streaming.upload();
+    bool second = streaming.upload();
+
+    // Assert
+    EXPECT_TRUE(first);
+    EXPECT_FALSE(second); // nothing new was published
+}
+
+TEST_F(StreamingTextureTestFixture, Upload_WithoutTripleBuffering_ReturnsFalse) {
+    // Arrange
+    StreamingTexture streaming(renderer_ptr->get_native_ptr(), texture_size);
+    ASSERT_TRUE(streaming.lock());
+    streaming.unlock();
+
+    // Act
+    bool uploaded = streaming.upload();
+
+    // Assert
+    EXPECT_FALSE(uploaded); // the texture was written directly
+}
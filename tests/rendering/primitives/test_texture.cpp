@@ -12,6 +12,7 @@ using penguin::window::Window;
 using penguin::window::WindowFlags;
 using penguin::rendering::Renderer;
 using penguin::rendering::primitives::Texture;
+using penguin::rendering::primitives::AlphaMode;
 using penguin::math::Vector2i;
 
 class TextureTestFixture : public ::testing::Test {
@@ -114,6 +115,32 @@ TEST_F(TextureTestFixture, GetSize_WithValidTexture_ReturnsCorrectSize) {
     EXPECT_EQ(texture_size.y, expected_size.y);
 }
 
+// Alpha Mode
+
+TEST_F(TextureTestFixture, GetAlphaMode_WithDefaultConstructor_ReturnsStraight) {
+    // Arrange
+    std::unique_ptr<Texture> texture_ptr = std::make_unique<Texture>(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    AlphaMode alpha_mode = texture_ptr->get_alpha_mode();
+
+    // Assert
+    EXPECT_EQ(AlphaMode::Straight, alpha_mode);
+}
+
+TEST_F(TextureTestFixture, Constructor_WithPremultipliedAlpha_CreatesTextureOfSameSize) {
+    // Arrange
+    Vector2i expected_size(362, 362);
+
+    // Act
+    std::unique_ptr<Texture> texture_ptr = std::make_unique<Texture>(renderer_ptr->get_native_ptr(), abs_path.c_str(), AlphaMode::Premultiplied);
+
+    // Assert
+    EXPECT_TRUE(texture_ptr->is_valid());
+    EXPECT_EQ(AlphaMode::Premultiplied, texture_ptr->get_alpha_mode());
+    EXPECT_EQ(expected_size, texture_ptr->get_size());
+}
+
 // Invalid Texture Operations
 
 TEST_F(TextureTestFixture, Constructor_InvalidRenderer_CreatesInvalidTexture) {
@@ -0,0 +1,156 @@
+#include <rendering/systems/internal/asset_archive.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+using penguin::internal::rendering::systems::AssetArchive;
+using penguin::internal::rendering::systems::AssetArchiveWriter;
+using penguin::internal::rendering::systems::ArchiveBlob;
+using penguin::internal::rendering::systems::normalize_archive_path;
+
+class AssetArchiveTestFixture : public ::testing::Test {
+protected:
+    std::string archive_path = (std::filesystem::temp_directory_path() / "penguin_asset_archive_test.pfpk").string();
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(archive_path, ec);
+    }
+
+    static std::vector<unsigned char> bytes(std::string_view text) {
+        return std::vector<unsigned char>(text.begin(), text.end());
+    }
+};
+
+// Writing & reading
+
+TEST_F(AssetArchiveTestFixture, Find_WithPackedEntries_ReturnsTheirContents) {
+    // Arrange
+    AssetArchiveWriter writer;
+    writer.add("a.txt", bytes("first"));
+    writer.add("sub/b.txt", bytes("second entry"));
+    ASSERT_TRUE(writer.write(archive_path.c_str()));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path.c_str()));
+
+    // Act
+    ArchiveBlob first = archive.find("a.txt");
+    ArchiveBlob second = archive.find("sub/b.txt");
+
+    // Assert
+    EXPECT_EQ(2u, archive.get_entry_count());
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ("first", std::string_view(reinterpret_cast<const char*>(first.data), first.size));
+    EXPECT_EQ("second entry", std::string_view(reinterpret_cast<const char*>(second.data), second.size));
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(second.data) % AssetArchive::Blob_Alignment);
+}
+
+TEST_F(AssetArchiveTestFixture, Find_WithMissingEntry_ReturnsEmptyBlob) {
+    // Arrange
+    AssetArchiveWriter writer;
+    writer.add("a.txt", bytes("first"));
+    ASSERT_TRUE(writer.write(archive_path.c_str()));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path.c_str()));
+
+    // Act
+    ArchiveBlob blob = archive.find("b.txt");
+
+    // Assert
+    EXPECT_FALSE(blob);
+    EXPECT_EQ(0u, blob.size);
+}
+
+TEST_F(AssetArchiveTestFixture, Add_WithSamePathTwice_KeepsTheLastContents) {
+    // Arrange
+    AssetArchiveWriter writer;
+    writer.add("a.txt", bytes("old"));
+    writer.add("./a.txt", bytes("new"));
+    ASSERT_TRUE(writer.write(archive_path.c_str()));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path.c_str()));
+
+    // Act
+    ArchiveBlob blob = archive.find("a.txt");
+
+    // Assert
+    EXPECT_EQ(1u, archive.get_entry_count());
+    ASSERT_TRUE(blob);
+    EXPECT_EQ("new", std::string_view(reinterpret_cast<const char*>(blob.data), blob.size));
+}
+
+TEST_F(AssetArchiveTestFixture, Open_WithNonArchiveFile_ReturnsFalse) {
+    // Arrange
+    {
+        std::ofstream file(archive_path, std::ios::binary);
+        file << "definitely not an archive";
+    }
+
+    AssetArchive archive;
+
+    // Act
+    bool opened = archive.open(archive_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(opened);
+    EXPECT_FALSE(archive.is_open());
+}
+
+TEST_F(AssetArchiveTestFixture, Open_WithBlobRangeThatWrapsAround_ReturnsFalse) {
+    // Arrange
+    AssetArchiveWriter writer;
+    writer.add("a.txt", bytes("first"));
+    ASSERT_TRUE(writer.write(archive_path.c_str()));
+
+    {
+        // Rewrite the record's data offset and stored size so that offset + size wraps to 8
+        std::fstream file(archive_path, std::ios::binary | std::ios::in | std::ios::out);
+        unsigned char range[16] = {};
+        range[0] = 16; // offset 16
+        for (int i = 8; i < 16; ++i) {
+            range[i] = 0xFF; // stored size 2^64 - 8
+        }
+        range[8] = 0xF8;
+
+        file.seekp(AssetArchive::Header_Size + 8);
+        file.write(reinterpret_cast<const char*>(range), sizeof(range));
+    }
+
+    AssetArchive archive;
+
+    // Act
+    bool opened = archive.open(archive_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(opened);
+    EXPECT_FALSE(archive.find("a.txt"));
+}
+
+TEST_F(AssetArchiveTestFixture, Open_WithMissingFile_ReturnsFalse) {
+    // Arrange
+    AssetArchive archive;
+
+    // Act
+    bool opened = archive.open("missing.pfpk");
+
+    // Assert
+    EXPECT_FALSE(opened);
+}
+
+// Paths
+
+TEST_F(AssetArchiveTestFixture, NormalizeArchivePath_WithMixedSeparators_UsesForwardSlashes) {
+    // Act
+    std::string path = normalize_archive_path(".\\images\\ui/button.png");
+
+    // Assert
+    EXPECT_EQ("images/ui/button.png", path);
+}
@@ -8,16 +8,32 @@
 #include <memory>
 #include <filesystem>
 #include <string>
+#include <future>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 #include <common/test_helpers.hpp>
+#include <rendering/systems/internal/asset_archive.hpp>
 
 using penguin::window::Window;
 using penguin::window::WindowFlags;
 using penguin::rendering::Renderer;
 using penguin::rendering::systems::AssetManager;
+using penguin::rendering::systems::AssetId;
+using penguin::rendering::systems::TextureHandle;
+using penguin::rendering::systems::FontHandle;
+using penguin::rendering::systems::PreloadManifest;
+using penguin::rendering::systems::PreloadProgress;
+using penguin::rendering::systems::TextureInfo;
+using penguin::rendering::systems::ImageFormat;
 using penguin::rendering::primitives::Texture;
 using penguin::rendering::primitives::Font;
+using penguin::rendering::primitives::FontStyle;
 using penguin::math::Vector2i;
+using penguin::internal::rendering::systems::AssetArchiveWriter;
 
 class AssetManagerTestFixture : public ::testing::Test {
 protected:
@@ -34,6 +50,7 @@ protected:
     const char* font_asset_name = "pixelify_sans_regular.ttf";
     std::string abs_path = std::filesystem::absolute(get_test_asset_path(asset_name)).string();
     std::string font_abs_path = std::filesystem::absolute(get_test_asset_path(font_asset_name)).string();
+    std::string svg_abs_path = std::filesystem::absolute(get_test_asset_path("penguin_icon.svg")).string();
 
     void SetUp() override {
         penguin::InitOptions options{ .headless_mode = true };
@@ -70,6 +87,37 @@ protected:
         // Safe to quit
         penguin::quit();
     }
+
+    // Pumps the upload queue like a render loop would, until the future is ready or the attempts run out
+    template <typename T>
+    bool wait_for_upload(const std::shared_future<T>& future, int max_frames = 500) {
+        for (int frame = 0; frame < max_frames; ++frame) {
+            content_ptr->process_uploads();
+
+            if (future.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+
+        return false;
+    }
+
+    // Packs the test image and font into an archive in the temp directory, returns its path
+    std::string write_test_archive() {
+        auto read_bytes = [](const std::filesystem::path& path) {
+            std::ifstream file(path, std::ios::binary);
+            return std::vector<unsigned char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        };
+
+        AssetArchiveWriter writer;
+        writer.add("images/penguin_cute.bmp", read_bytes(abs_path));
+        writer.add("fonts/pixelify_sans_regular.ttf", read_bytes(font_abs_path));
+
+        std::string archive_path = (std::filesystem::temp_directory_path() / "penguin_asset_manager_test.pfpk").string();
+        return writer.write(archive_path.c_str()) ? archive_path : std::string();
+    }
 };
 
 // Validity
@@ -170,6 +218,49 @@ TEST_F(AssetManagerTestFixture, LoadTexture_WithInvalidPathExt_ReturnsNullPtr) {
 
 // Load Font
 
+TEST_F(AssetManagerTestFixture, LoadTexture_WithSvgTargetSize_RasterisesAtThatSize) {
+    // Act
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture(svg_abs_path.c_str(), Vector2i(128, 128));
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    EXPECT_TRUE(texture_ptr->is_valid());
+    EXPECT_EQ(Vector2i(128, 128), texture_ptr->get_size());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_WithSvgSizesInSameBucket_ReturnsCachedTexture) {
+    // Act
+    std::shared_ptr<Texture> first_ptr = content_ptr->load_texture(svg_abs_path.c_str(), Vector2i(100, 100));
+    std::shared_ptr<Texture> second_ptr = content_ptr->load_texture(svg_abs_path.c_str(), Vector2i(103, 102)); // both round up to 104
+
+    // Assert
+    ASSERT_NE(first_ptr, nullptr);
+    EXPECT_EQ(first_ptr, second_ptr);
+    EXPECT_EQ(Vector2i(104, 104), first_ptr->get_size());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_WithSvgSizesInDifferentBuckets_ReturnsDifferentTextures) {
+    // Act
+    std::shared_ptr<Texture> small_ptr = content_ptr->load_texture(svg_abs_path.c_str(), Vector2i(32, 32));
+    std::shared_ptr<Texture> large_ptr = content_ptr->load_texture(svg_abs_path.c_str(), Vector2i(256, 256));
+
+    // Assert
+    ASSERT_NE(small_ptr, nullptr);
+    ASSERT_NE(large_ptr, nullptr);
+    EXPECT_NE(small_ptr, large_ptr);
+    EXPECT_EQ(Vector2i(256, 256), large_ptr->get_size());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_WithRasterImageAndTargetSize_LoadsAtOwnSize) {
+    // Act
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture(abs_path.c_str(), Vector2i(64, 64));
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    EXPECT_EQ(Vector2i(362, 362), texture_ptr->get_size());
+    EXPECT_EQ(texture_ptr, content_ptr->load_texture(abs_path.c_str()));
+}
+
 TEST_F(AssetManagerTestFixture, LoadFont_WithValidPath_ReturnsValidTexture) {
     // Arrange & Act
     std::shared_ptr<Font> font_ptr = content_ptr->load_font(font_abs_path.c_str());
@@ -194,6 +285,16 @@ TEST_F(AssetManagerTestFixture, LoadFont_WithValidPath_ReturnsValidTexture) {
 
 // Invalid Load Font
 
+TEST_F(AssetManagerTestFixture, LoadFont_WithPrewarmCharset_ReturnsValidFont) {
+    // Arrange & Act
+    std::shared_ptr<Font> font_ptr = content_ptr->load_font(font_abs_path.c_str(), 16.0f, 1, FontStyle::Normal, Font::Ascii_Charset);
+
+    // Assert
+    ASSERT_NE(font_ptr, nullptr);
+    EXPECT_TRUE(font_ptr->is_valid());
+    EXPECT_FLOAT_EQ(16.0f, font_ptr->get_size());
+}
+
 TEST_F(AssetManagerTestFixture, LoadFont_WithInvalidAssetManager_ReturnsNullPtr) {
     // Arrange & Act
     std::shared_ptr<Font> font_ptr = invalid_content_ptr->load_font(font_abs_path.c_str());
@@ -227,4 +328,424 @@ TEST_F(AssetManagerTestFixture, LoadFont_WithInvalidPathExt_ReturnsNullPtr) {
     // Assert
     EXPECT_TRUE(content_ptr->is_valid());
     EXPECT_EQ(font_ptr, nullptr);
-}
\ No newline at end of file
+}
+
+// Asynchronous loading
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_WithValidPath_ResolvesAfterProcessingUploads) {
+    // Arrange
+    std::shared_future<std::shared_ptr<Texture>> future = content_ptr->load_texture_async(abs_path.c_str());
+
+    // Act
+    ASSERT_TRUE(wait_for_upload(future));
+    std::shared_ptr<Texture> texture_ptr = future.get();
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    EXPECT_TRUE(texture_ptr->is_valid());
+    EXPECT_EQ(texture_ptr, content_ptr->load_texture(abs_path.c_str())); // cached like a synchronous load
+    EXPECT_EQ(0u, content_ptr->get_pending_uploads());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_WithSamePathTwice_SharesOneLoad) {
+    // Arrange
+    std::shared_future<std::shared_ptr<Texture>> first = content_ptr->load_texture_async(abs_path.c_str());
+    std::shared_future<std::shared_ptr<Texture>> second = content_ptr->load_texture_async(abs_path.c_str());
+
+    // Act
+    ASSERT_TRUE(wait_for_upload(first));
+    ASSERT_TRUE(wait_for_upload(second));
+
+    // Assert
+    ASSERT_NE(first.get(), nullptr);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(0u, content_ptr->get_pending_uploads()); // the image was only decoded and uploaded once
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_WithCachedTexture_ResolvesImmediately) {
+    // Arrange
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture(abs_path.c_str());
+
+    // Act
+    std::shared_future<std::shared_ptr<Texture>> future = content_ptr->load_texture_async(abs_path.c_str());
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_EQ(texture_ptr, future.get());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_WithInvalidPath_ResolvesToNullPtr) {
+    // Arrange
+    std::string invalid_abs_path = std::filesystem::absolute(get_test_asset_path("missing.png")).string();
+
+    // Act
+    std::shared_future<std::shared_ptr<Texture>> future = content_ptr->load_texture_async(invalid_abs_path.c_str());
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_EQ(future.get(), nullptr);
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_WithInvalidAssetManager_ResolvesToNullPtr) {
+    // Arrange & Act
+    std::shared_future<std::shared_ptr<Texture>> future = invalid_content_ptr->load_texture_async(abs_path.c_str());
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_EQ(future.get(), nullptr);
+}
+
+TEST_F(AssetManagerTestFixture, LoadFontAsync_WithValidPath_ResolvesAfterProcessingUploads) {
+    // Arrange
+    std::shared_future<std::shared_ptr<Font>> future = content_ptr->load_font_async(font_abs_path.c_str(), 24.0f);
+
+    // Act
+    ASSERT_TRUE(wait_for_upload(future));
+    std::shared_ptr<Font> font_ptr = future.get();
+
+    // Assert
+    ASSERT_NE(font_ptr, nullptr);
+    EXPECT_TRUE(font_ptr->is_valid());
+    EXPECT_FLOAT_EQ(24.0f, font_ptr->get_size());
+    EXPECT_EQ(font_ptr, content_ptr->load_font(font_abs_path.c_str(), 24.0f));
+}
+
+TEST_F(AssetManagerTestFixture, LoadFontAsync_WithUnreadableFile_ResolvesToNullPtrWithoutUploading) {
+    // Arrange
+    std::filesystem::path empty_path = std::filesystem::temp_directory_path() / "penguin_empty_font.ttf";
+    std::ofstream(empty_path).close(); // exists, but has nothing to read
+
+    // Act
+    std::shared_future<std::shared_ptr<Font>> future = content_ptr->load_font_async(empty_path.string().c_str(), 24.0f);
+    std::future_status status = future.wait_for(std::chrono::seconds(5)); // resolved by the worker, not by process_uploads()
+
+    std::error_code ec;
+    std::filesystem::remove(empty_path, ec);
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, status);
+    EXPECT_EQ(future.get(), nullptr);
+    EXPECT_EQ(0u, content_ptr->process_uploads());
+    EXPECT_EQ(0u, content_ptr->get_font_stats().entries);
+}
+
+TEST_F(AssetManagerTestFixture, ProcessUploads_WithNothingQueued_ReturnsZero) {
+    // Act
+    std::size_t processed = content_ptr->process_uploads();
+
+    // Assert
+    EXPECT_EQ(0u, processed);
+}
+
+// Packed archives
+
+TEST_F(AssetManagerTestFixture, MountArchive_WithValidArchive_ReturnsTrue) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_FALSE(archive_path.empty());
+
+    // Act
+    bool mounted = content_ptr->mount_archive(archive_path.c_str());
+
+    // Assert
+    EXPECT_TRUE(mounted);
+}
+
+TEST_F(AssetManagerTestFixture, MountArchive_WithMissingFile_ReturnsFalse) {
+    // Arrange
+    std::string invalid_abs_path = std::filesystem::absolute(get_test_asset_path("missing.pfpk")).string();
+
+    // Act
+    bool mounted = content_ptr->mount_archive(invalid_abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(mounted);
+}
+
+TEST_F(AssetManagerTestFixture, MountArchive_WithNonArchiveFile_ReturnsFalse) {
+    // Act
+    bool mounted = content_ptr->mount_archive(abs_path.c_str()); // a BMP, not an archive
+
+    // Assert
+    EXPECT_FALSE(mounted);
+}
+
+TEST_F(AssetManagerTestFixture, MountArchive_WithInvalidAssetManager_ReturnsFalse) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+
+    // Act
+    bool mounted = invalid_content_ptr->mount_archive(archive_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(mounted);
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_FromMountedArchive_ReturnsValidTexture) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_TRUE(content_ptr->mount_archive(archive_path.c_str(), "packed"));
+
+    // Act
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture("packed/images/penguin_cute.bmp"); // only exists in the archive
+    std::shared_ptr<Texture> disk_texture_ptr = content_ptr->load_texture(abs_path.c_str());
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    ASSERT_NE(disk_texture_ptr, nullptr);
+    EXPECT_TRUE(texture_ptr->is_valid());
+    EXPECT_EQ(disk_texture_ptr->get_size(), texture_ptr->get_size());
+    EXPECT_EQ(texture_ptr, content_ptr->load_texture("packed/images/penguin_cute.bmp")); // cached like a loose file
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_OutsideMountPoint_ReturnsNullPtr) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_TRUE(content_ptr->mount_archive(archive_path.c_str(), "packed"));
+
+    // Act
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture("images/penguin_cute.bmp");
+
+    // Assert
+    EXPECT_EQ(texture_ptr, nullptr);
+}
+
+TEST_F(AssetManagerTestFixture, LoadFont_FromMountedArchive_ReturnsValidFont) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_TRUE(content_ptr->mount_archive(archive_path.c_str()));
+
+    // Act
+    std::shared_ptr<Font> font_ptr = content_ptr->load_font("fonts/pixelify_sans_regular.ttf", 18.0f);
+
+    // Assert
+    ASSERT_NE(font_ptr, nullptr);
+    EXPECT_TRUE(font_ptr->is_valid());
+    EXPECT_FLOAT_EQ(18.0f, font_ptr->get_size());
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureAsync_FromMountedArchive_ResolvesAfterProcessingUploads) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_TRUE(content_ptr->mount_archive(archive_path.c_str(), "packed/"));
+    std::shared_future<std::shared_ptr<Texture>> future = content_ptr->load_texture_async("packed/images/penguin_cute.bmp");
+
+    // Act
+    ASSERT_TRUE(wait_for_upload(future));
+    std::shared_ptr<Texture> texture_ptr = future.get();
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    EXPECT_TRUE(texture_ptr->is_valid());
+}
+
+// Disk cache
+
+TEST_F(AssetManagerTestFixture, SetTextureDiskCache_WithWritableDirectory_ReturnsTrue) {
+    // Arrange
+    std::filesystem::path cache_dir = std::filesystem::temp_directory_path() / "penguin_texture_cache_test";
+    std::filesystem::remove_all(cache_dir);
+
+    // Act
+    bool enabled = content_ptr->set_texture_disk_cache(cache_dir.string().c_str());
+
+    // Assert
+    EXPECT_TRUE(enabled);
+    EXPECT_TRUE(std::filesystem::is_directory(cache_dir));
+}
+
+TEST_F(AssetManagerTestFixture, SetTextureDiskCache_WithInvalidAssetManager_ReturnsFalse) {
+    // Act
+    bool enabled = invalid_content_ptr->set_texture_disk_cache(std::filesystem::temp_directory_path().string().c_str());
+
+    // Assert
+    EXPECT_FALSE(enabled);
+}
+
+TEST_F(AssetManagerTestFixture, LoadTexture_WithDiskCache_StoresEntryForLaterRuns) {
+    // Arrange
+    std::filesystem::path cache_dir = std::filesystem::temp_directory_path() / "penguin_texture_cache_test";
+    std::filesystem::remove_all(cache_dir);
+    ASSERT_TRUE(content_ptr->set_texture_disk_cache(cache_dir.string().c_str()));
+
+    // Act
+    std::shared_ptr<Texture> texture_ptr = content_ptr->load_texture(abs_path.c_str());
+
+    AssetManager next_run(*renderer_ptr); // a fresh manager has nothing in memory, so it reads the disk cache
+    ASSERT_TRUE(next_run.set_texture_disk_cache(cache_dir.string().c_str()));
+    std::shared_ptr<Texture> cached_texture_ptr = next_run.load_texture(abs_path.c_str());
+
+    // Assert
+    ASSERT_NE(texture_ptr, nullptr);
+    ASSERT_NE(cached_texture_ptr, nullptr);
+    EXPECT_TRUE(cached_texture_ptr->is_valid());
+    EXPECT_EQ(texture_ptr->get_size(), cached_texture_ptr->get_size());
+    EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator(cache_dir), std::filesystem::directory_iterator{}));
+}
+
+// Interned handles
+
+TEST_F(AssetManagerTestFixture, LoadTextureHandle_WithValidPath_ResolvesToCachedTexture) {
+    // Act
+    TextureHandle handle = content_ptr->load_texture_handle(abs_path.c_str());
+
+    // Assert
+    ASSERT_TRUE(handle.is_valid());
+    ASSERT_NE(content_ptr->get_texture(handle), nullptr);
+    EXPECT_EQ(content_ptr->load_texture(abs_path.c_str()), content_ptr->get_texture(handle));
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureHandle_WithSamePathTwice_ReturnsSameHandle) {
+    // Act
+    TextureHandle first = content_ptr->load_texture_handle(abs_path.c_str());
+    TextureHandle second = content_ptr->load_texture_handle(abs_path.c_str());
+
+    // Assert
+    EXPECT_TRUE(first.is_valid());
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(AssetManagerTestFixture, LoadTextureHandle_WithInvalidPath_ReturnsInvalidHandle) {
+    // Arrange
+    std::string invalid_abs_path = std::filesystem::absolute(get_test_asset_path("missing.png")).string();
+
+    // Act
+    TextureHandle handle = content_ptr->load_texture_handle(invalid_abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(handle.is_valid());
+    EXPECT_EQ(content_ptr->get_texture(handle), nullptr);
+}
+
+TEST_F(AssetManagerTestFixture, FindTextureHandle_WithAssetIdOfInternedPath_ReturnsSameHandle) {
+    // Arrange
+    TextureHandle handle = content_ptr->load_texture_handle(abs_path.c_str());
+
+    // Act
+    TextureHandle found = content_ptr->find_texture_handle(AssetId(abs_path));
+    TextureHandle missing = content_ptr->find_texture_handle(AssetId("never_interned.png"));
+
+    // Assert
+    EXPECT_EQ(handle, found);
+    EXPECT_FALSE(missing.is_valid());
+}
+
+TEST_F(AssetManagerTestFixture, LoadFontHandle_WithDifferentSizes_ReturnsDifferentHandles) {
+    // Act
+    FontHandle small = content_ptr->load_font_handle(font_abs_path.c_str(), 12.0f);
+    FontHandle large = content_ptr->load_font_handle(font_abs_path.c_str(), 32.0f);
+
+    // Assert
+    ASSERT_TRUE(small.is_valid());
+    ASSERT_TRUE(large.is_valid());
+    EXPECT_NE(small, large);
+    EXPECT_FLOAT_EQ(32.0f, content_ptr->get_font(large)->get_size());
+    EXPECT_EQ(small, content_ptr->find_font_handle(AssetId(font_abs_path), 12.0f));
+}
+
+TEST_F(AssetManagerTestFixture, AssetId_WithPathAtCompileTime_MatchesRuntimeHash) {
+    // Arrange
+    constexpr AssetId compile_time_id("assets/player.png");
+    std::string path = "assets/player.png";
+
+    // Act
+    AssetId runtime_id(path);
+
+    // Assert
+    static_assert(compile_time_id.hash != 0);
+    EXPECT_EQ(compile_time_id, runtime_id);
+}
+
+// Preloading
+
+TEST_F(AssetManagerTestFixture, Preload_WithValidManifest_LoadsEveryAsset) {
+    // Arrange
+    PreloadManifest manifest;
+    manifest.textures = { abs_path };
+    manifest.fonts = { { font_abs_path, 16.0f }, { font_abs_path, 24.0f } };
+
+    // Act
+    std::size_t loaded = content_ptr->preload(manifest);
+
+    // Assert
+    EXPECT_EQ(3u, loaded);
+    EXPECT_NE(content_ptr->get_texture_stats().entries, 0u);
+    EXPECT_EQ(2u, content_ptr->get_font_stats().entries);
+    EXPECT_EQ(0u, content_ptr->get_pending_uploads());
+}
+
+TEST_F(AssetManagerTestFixture, Preload_WithProgressCallback_ReportsEachAsset) {
+    // Arrange
+    std::string invalid_abs_path = std::filesystem::absolute(get_test_asset_path("missing.png")).string();
+
+    PreloadManifest manifest;
+    manifest.textures = { abs_path, invalid_abs_path };
+    manifest.fonts = { { font_abs_path, 20.0f } };
+
+    std::vector<PreloadProgress> reports;
+
+    // Act
+    std::size_t loaded = content_ptr->preload(manifest, [&reports](const PreloadProgress& progress) { reports.push_back(progress); });
+
+    // Assert
+    EXPECT_EQ(2u, loaded);
+    ASSERT_EQ(3u, reports.size());
+    EXPECT_TRUE(reports.back().is_done());
+    EXPECT_EQ(1u, reports.back().failed);
+    EXPECT_FLOAT_EQ(1.0f, reports.back().get_fraction());
+}
+
+TEST_F(AssetManagerTestFixture, Preload_WithInvalidAssetManager_ReturnsZero) {
+    // Arrange
+    PreloadManifest manifest;
+    manifest.textures = { abs_path };
+
+    // Act
+    std::size_t loaded = invalid_content_ptr->preload(manifest);
+
+    // Assert
+    EXPECT_EQ(0u, loaded);
+}
+
+// Probing
+
+TEST_F(AssetManagerTestFixture, ProbeTexture_WithValidPath_ReturnsSizeWithoutLoading) {
+    // Act
+    TextureInfo info = content_ptr->probe_texture(abs_path.c_str());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Bmp, info.format);
+    EXPECT_EQ(362, info.size.x);
+    EXPECT_EQ(362, info.size.y);
+    EXPECT_EQ(0u, content_ptr->get_texture_stats().entries); // nothing was decoded or cached
+}
+
+TEST_F(AssetManagerTestFixture, ProbeTexture_FromMountedArchive_ReturnsSize) {
+    // Arrange
+    std::string archive_path = write_test_archive();
+    ASSERT_TRUE(content_ptr->mount_archive(archive_path.c_str(), "packed"));
+
+    // Act
+    TextureInfo info = content_ptr->probe_texture("packed/images/penguin_cute.bmp");
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Bmp, info.format);
+    EXPECT_EQ(362, info.size.x);
+    EXPECT_EQ(362, info.size.y);
+}
+
+TEST_F(AssetManagerTestFixture, ProbeTexture_WithFontFile_ReturnsUnknown) {
+    // Act
+    TextureInfo info = content_ptr->probe_texture(font_abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(info);
+}
+
+TEST_F(AssetManagerTestFixture, ProbeTexture_WithInvalidAssetManager_ReturnsUnknown) {
+    // Act
+    TextureInfo info = invalid_content_ptr->probe_texture(abs_path.c_str());
+
+    // Assert
+    EXPECT_FALSE(info);
+}
@@ -1,12 +1,15 @@
 #include <penguin_framework/window/window.hpp>
 #include <penguin_framework/rendering/renderer.hpp>
 #include <penguin_framework/rendering/primitives/font.hpp>
+#include <penguin_framework/rendering/primitives/font_style.hpp>
 #include <penguin_framework/rendering/systems/font_loader.hpp>
 #include <penguin_framework/penguin_init.hpp>
 #include <gtest/gtest.h>
 #include <memory>
 #include <filesystem>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <common/test_helpers.hpp>
 
@@ -15,6 +18,7 @@ using penguin::window::WindowFlags;
 using penguin::rendering::Renderer;
 using penguin::rendering::systems::FontLoader;
 using penguin::rendering::primitives::Font;
+using penguin::rendering::primitives::FontStyle;
 using penguin::math::Vector2i;
 
 class FontLoaderTestFixture : public ::testing::Test {
@@ -92,4 +96,130 @@ TEST_F(FontLoaderTestFixture, LoadFunction_WithValidParameters_ReturnsValidFont)
     EXPECT_FALSE(font_ptr->is_italic());
     EXPECT_FALSE(font_ptr->is_underline());
     EXPECT_FALSE(font_ptr->is_strikethrough());
-}
\ No newline at end of file
+}
+
+// Cache
+
+TEST_F(FontLoaderTestFixture, LoadFunction_WithSameParameters_ReturnsCachedFont) {
+    // Arrange
+    std::shared_ptr<Font> first_font = loader_ptr->load(abs_path.c_str(), 24.0f);
+
+    // Act
+    std::shared_ptr<Font> second_font = loader_ptr->load(abs_path.c_str(), 24.0f);
+
+    // Assert
+    EXPECT_TRUE(first_font->is_valid());
+    EXPECT_EQ(first_font, second_font);
+}
+
+TEST_F(FontLoaderTestFixture, LoadFunction_WithDifferentSizes_ReturnsDistinctFonts) {
+    // Arrange
+    float small_size = 12.0f;
+    float large_size = 48.0f;
+
+    // Act
+    std::shared_ptr<Font> small_font = loader_ptr->load(abs_path.c_str(), small_size);
+    std::shared_ptr<Font> large_font = loader_ptr->load(abs_path.c_str(), large_size);
+
+    // Assert
+    EXPECT_TRUE(small_font->is_valid());
+    EXPECT_TRUE(large_font->is_valid());
+    EXPECT_NE(small_font, large_font);
+    EXPECT_FLOAT_EQ(small_size, small_font->get_size());
+    EXPECT_FLOAT_EQ(large_size, large_font->get_size());
+}
+
+TEST_F(FontLoaderTestFixture, GetStats_WithSeveralSizesOfOneFile_CountsTheFileOnce) {
+    // Arrange
+    std::uintmax_t file_size = std::filesystem::file_size(abs_path);
+
+    // Act
+    std::shared_ptr<Font> small_font = loader_ptr->load(abs_path.c_str(), 12.0f);
+    std::shared_ptr<Font> large_font = loader_ptr->load(abs_path.c_str(), 48.0f);
+
+    // Assert
+    EXPECT_EQ(2u, loader_ptr->get_stats().entries);
+    EXPECT_EQ(file_size, loader_ptr->get_stats().resident_bytes); // both fonts share one file buffer
+}
+
+TEST_F(FontLoaderTestFixture, Trim_AfterSeveralSizesOfOneFileReleased_EvictsThemAll) {
+    // Arrange
+    std::shared_ptr<Font> small_font = loader_ptr->load(abs_path.c_str(), 12.0f);
+    std::shared_ptr<Font> large_font = loader_ptr->load(abs_path.c_str(), 48.0f);
+    small_font.reset();
+    large_font.reset();
+
+    // Act
+    loader_ptr->trim();
+
+    // Assert
+    EXPECT_EQ(0u, loader_ptr->get_stats().entries);
+    EXPECT_EQ(0u, loader_ptr->get_stats().resident_bytes);
+}
+
+TEST_F(FontLoaderTestFixture, Trim_AfterFirstSizeOfFileReleased_StillCountsTheFile) {
+    // Arrange
+    std::uintmax_t file_size = std::filesystem::file_size(abs_path);
+    std::shared_ptr<Font> small_font = loader_ptr->load(abs_path.c_str(), 12.0f);
+    std::shared_ptr<Font> large_font = loader_ptr->load(abs_path.c_str(), 48.0f);
+    small_font.reset();
+
+    // Act
+    loader_ptr->trim();
+
+    // Assert
+    EXPECT_EQ(1u, loader_ptr->get_stats().entries);
+    EXPECT_EQ(file_size, loader_ptr->get_stats().resident_bytes); // the large font still holds the file
+}
+
+TEST_F(FontLoaderTestFixture, LoadFunction_WithStyle_ReturnsStyledFont) {
+    // Arrange
+    std::shared_ptr<Font> normal_font = loader_ptr->load(abs_path.c_str());
+
+    // Act
+    std::shared_ptr<Font> bold_font = loader_ptr->load(abs_path.c_str(), 12.0f, 1, FontStyle::Bold | FontStyle::Italic);
+
+    // Assert
+    EXPECT_NE(normal_font, bold_font);
+    EXPECT_TRUE(normal_font->is_normal());
+    EXPECT_TRUE(bold_font->is_bold());
+    EXPECT_TRUE(bold_font->is_italic());
+    EXPECT_FALSE(bold_font->is_underline());
+}
+
+TEST_F(FontLoaderTestFixture, LoadFunction_FromSeveralThreads_SharesOneFont) {
+    // Arrange
+    const int thread_count = 8;
+    std::vector<std::shared_ptr<Font>> fonts(thread_count);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([this, &fonts, i]() {
+            fonts[i] = loader_ptr->load(abs_path.c_str(), 32.0f);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    ASSERT_NE(fonts[0], nullptr);
+    EXPECT_TRUE(fonts[0]->is_valid());
+    for (const std::shared_ptr<Font>& font : fonts) {
+        EXPECT_EQ(fonts[0], font); // opened once, the other threads waited for it
+    }
+}
+
+TEST_F(FontLoaderTestFixture, FindFunction_WithUnloadedFont_ReturnsNullPtr) {
+    // Arrange
+    std::shared_ptr<Font> font = loader_ptr->load(abs_path.c_str(), 16.0f);
+
+    // Act
+    std::shared_ptr<Font> found = loader_ptr->find(abs_path.c_str(), 16.0f);
+    std::shared_ptr<Font> missing = loader_ptr->find(abs_path.c_str(), 17.0f);
+
+    // Assert
+    EXPECT_EQ(font, found);
+    EXPECT_EQ(missing, nullptr);
+}
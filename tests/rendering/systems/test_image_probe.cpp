@@ -0,0 +1,159 @@
+#include <rendering/systems/internal/image_probe.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using penguin::internal::rendering::systems::probe_image;
+using penguin::rendering::systems::ImageFormat;
+using penguin::rendering::systems::TextureInfo;
+
+class ImageProbeTestFixture : public ::testing::Test {
+protected:
+    std::string file_path = (std::filesystem::temp_directory_path() / "penguin_image_probe_test.bin").string();
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(file_path, ec);
+    }
+
+    static std::vector<unsigned char> png_header(unsigned int width, unsigned int height) {
+        std::vector<unsigned char> bytes = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A, 0, 0, 0, 13, 'I', 'H', 'D', 'R' };
+        for (unsigned int value : { width, height }) {
+            bytes.push_back(static_cast<unsigned char>(value >> 24));
+            bytes.push_back(static_cast<unsigned char>(value >> 16));
+            bytes.push_back(static_cast<unsigned char>(value >> 8));
+            bytes.push_back(static_cast<unsigned char>(value));
+        }
+        return bytes;
+    }
+
+    static std::vector<unsigned char> jpeg_header(unsigned int width, unsigned int height) {
+        return {
+            0xFF, 0xD8, // SOI
+            0xFF, 0xE0, 0x00, 0x06, 'J', 'F', 'I', 'F', // APP0, shortened
+            0xFF, 0xC4, 0x00, 0x03, 0x00, // DHT, which must not be mistaken for a frame header
+            0xFF, 0xC2, 0x00, 0x0B, 0x08, // SOF2 (progressive), precision
+            static_cast<unsigned char>(height >> 8), static_cast<unsigned char>(height),
+            static_cast<unsigned char>(width >> 8), static_cast<unsigned char>(width),
+            0x01, 0x01, 0x11, 0x00
+        };
+    }
+
+    void write_file(const std::vector<unsigned char>& bytes) const {
+        std::ofstream file(file_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+};
+
+// Formats
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithPngHeader_ReturnsSize) {
+    // Arrange
+    std::vector<unsigned char> bytes = png_header(640, 480);
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Png, info.format);
+    EXPECT_EQ(640, info.size.x);
+    EXPECT_EQ(480, info.size.y);
+}
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithJpegHeader_SkipsToTheFrameHeader) {
+    // Arrange
+    std::vector<unsigned char> bytes = jpeg_header(1920, 1080);
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Jpeg, info.format);
+    EXPECT_EQ(1920, info.size.x);
+    EXPECT_EQ(1080, info.size.y);
+}
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithTopDownBmpHeader_ReturnsPositiveHeight) {
+    // Arrange
+    std::vector<unsigned char> bytes(26, 0);
+    bytes[0] = 'B';
+    bytes[1] = 'M';
+    bytes[14] = 40; // BITMAPINFOHEADER
+    bytes[18] = 0x20; // width 32
+    bytes[22] = 0xF0; // height -16
+    bytes[23] = 0xFF;
+    bytes[24] = 0xFF;
+    bytes[25] = 0xFF;
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Bmp, info.format);
+    EXPECT_EQ(32, info.size.x);
+    EXPECT_EQ(16, info.size.y);
+}
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithGifHeader_ReturnsScreenSize) {
+    // Arrange
+    std::vector<unsigned char> bytes = { 'G', 'I', 'F', '8', '9', 'a', 0x2C, 0x01, 0xC8, 0x00 };
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Gif, info.format);
+    EXPECT_EQ(300, info.size.x);
+    EXPECT_EQ(200, info.size.y);
+}
+
+// Failure cases
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithTruncatedPngHeader_ReturnsUnknown) {
+    // Arrange
+    std::vector<unsigned char> bytes = png_header(640, 480);
+    bytes.resize(20);
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_FALSE(info);
+    EXPECT_EQ(ImageFormat::Unknown, info.format);
+}
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithUnsupportedData_ReturnsUnknown) {
+    // Arrange
+    std::vector<unsigned char> bytes = { 'n', 'o', 't', ' ', 'a', 'n', ' ', 'i', 'm', 'a', 'g', 'e' };
+
+    // Act
+    TextureInfo info = probe_image(bytes.data(), bytes.size());
+
+    // Assert
+    EXPECT_FALSE(info);
+}
+
+// Files
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithJpegFile_ReturnsSize) {
+    // Arrange
+    write_file(jpeg_header(800, 600));
+
+    // Act
+    TextureInfo info = probe_image(file_path.c_str());
+
+    // Assert
+    EXPECT_EQ(ImageFormat::Jpeg, info.format);
+    EXPECT_EQ(800, info.size.x);
+    EXPECT_EQ(600, info.size.y);
+}
+
+TEST_F(ImageProbeTestFixture, ProbeImage_WithMissingFile_ReturnsUnknown) {
+    // Act
+    TextureInfo info = probe_image("missing.png");
+
+    // Assert
+    EXPECT_FALSE(info);
+}
@@ -4,6 +4,7 @@
 #include <penguin_framework/rendering/systems/texture_loader.hpp>
 #include <penguin_framework/penguin_init.hpp>
 #include <gtest/gtest.h>
+#include <SDL3/SDL_surface.h>
 #include <memory>
 #include <filesystem>
 #include <string>
@@ -15,6 +16,7 @@ using penguin::window::WindowFlags;
 using penguin::rendering::Renderer;
 using penguin::rendering::systems::TextureLoader;
 using penguin::rendering::primitives::Texture;
+using penguin::rendering::systems::CacheStats;
 using penguin::math::Vector2i;
 
 class TextureLoaderTestFixture : public ::testing::Test {
@@ -110,4 +112,130 @@ TEST_F(TextureLoaderTestFixture, LoadFunction_WithInvalidRenderer_ReturnsInvalid
     EXPECT_TRUE(loader_ptr->is_valid());
 
     EXPECT_TRUE(texture_ptr || !texture_ptr->is_valid()); // Texture should be null or invalid when created with invalid renderer
-}
\ No newline at end of file
+}
+
+// Memory budget
+
+TEST_F(TextureLoaderTestFixture, GetStats_AfterMissAndHit_CountsBothAndResidentBytes) {
+    // Arrange
+    std::shared_ptr<Texture> first = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    std::shared_ptr<Texture> second = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+    CacheStats stats = loader_ptr->get_stats();
+
+    // Assert
+    Vector2i size = first->get_size();
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.entries);
+    EXPECT_GE(stats.resident_bytes, static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y)); // at least one byte per pixel
+}
+
+TEST_F(TextureLoaderTestFixture, SetMemoryBudget_WithUnreferencedTexture_EvictsIt) {
+    // Arrange
+    loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str()); // the returned texture is dropped right away
+
+    // Act
+    loader_ptr->set_memory_budget(1);
+    CacheStats stats = loader_ptr->get_stats();
+
+    // Assert
+    EXPECT_EQ(1u, loader_ptr->get_memory_budget());
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(0u, stats.entries);
+    EXPECT_EQ(0u, stats.resident_bytes);
+}
+
+TEST_F(TextureLoaderTestFixture, SetMemoryBudget_WithReferencedTexture_KeepsIt) {
+    // Arrange
+    std::shared_ptr<Texture> texture_ptr = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    loader_ptr->set_memory_budget(1);
+
+    // Assert
+    EXPECT_EQ(0u, loader_ptr->get_stats().evictions);
+    EXPECT_EQ(texture_ptr, loader_ptr->find(abs_path.c_str()));
+}
+
+TEST_F(TextureLoaderTestFixture, Trim_AfterTextureReleased_EvictsIt) {
+    // Arrange
+    std::shared_ptr<Texture> texture_ptr = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+    texture_ptr.reset();
+
+    // Act
+    loader_ptr->trim();
+
+    // Assert
+    EXPECT_EQ(loader_ptr->find(abs_path.c_str()), nullptr);
+    EXPECT_EQ(1u, loader_ptr->get_stats().evictions);
+}
+
+// Content deduplication
+
+TEST_F(TextureLoaderTestFixture, LoadFunction_WithIdenticalFileUnderAnotherPath_SharesTexture) {
+    // Arrange
+    std::filesystem::path copy_path = std::filesystem::temp_directory_path() / "penguin_cute_copy.bmp";
+    std::filesystem::copy_file(abs_path, copy_path, std::filesystem::copy_options::overwrite_existing);
+
+    // Act
+    std::shared_ptr<Texture> original = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+    std::shared_ptr<Texture> copy = loader_ptr->load(renderer_ptr->get_native_ptr(), copy_path.string().c_str());
+
+    std::error_code ec;
+    std::filesystem::remove(copy_path, ec); // only needed for the loads
+
+    // Assert
+    ASSERT_NE(original, nullptr);
+    EXPECT_TRUE(original->is_valid());
+    EXPECT_EQ(original, copy);
+    EXPECT_EQ(1u, loader_ptr->get_stats().entries);
+    EXPECT_EQ(copy, loader_ptr->find(copy_path.string().c_str()));
+}
+
+TEST_F(TextureLoaderTestFixture, LoadFunction_WithSameContentHash_SharesTexture) {
+    // Arrange
+    std::unique_ptr<SDL_Surface, void(*)(SDL_Surface*)> surface(SDL_LoadBMP(abs_path.c_str()), &SDL_DestroySurface);
+    ASSERT_NE(surface, nullptr);
+    std::shared_ptr<Texture> original = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str(), NativeSurfacePtr{ surface.get() }, 42);
+
+    // Act
+    std::shared_ptr<Texture> alias = loader_ptr->load(renderer_ptr->get_native_ptr(), "alias.png", NativeSurfacePtr{ nullptr }, 42); // the surface is never read on a hit
+
+    // Assert
+    EXPECT_TRUE(original->is_valid());
+    EXPECT_EQ(original, alias);
+    EXPECT_EQ(1u, loader_ptr->get_stats().misses);
+}
+
+TEST_F(TextureLoaderTestFixture, LoadFunction_WithFailedUpload_DoesNotCacheIt) {
+    // Arrange
+    std::shared_ptr<Texture> failed = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str(), NativeSurfacePtr{ nullptr }, 42);
+
+    // Act
+    std::shared_ptr<Texture> retried = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str(), NativeSurfacePtr{ nullptr }, 42);
+
+    // Assert
+    EXPECT_FALSE(failed->is_valid());
+    EXPECT_NE(failed, retried); // loaded again rather than served from the cache
+    EXPECT_EQ(0u, loader_ptr->get_stats().entries);
+    EXPECT_EQ(nullptr, loader_ptr->find(abs_path.c_str()));
+}
+
+// Alpha mode
+
+TEST_F(TextureLoaderTestFixture, SetAlphaMode_WithPremultiplied_LoadsSeparatePremultipliedTexture) {
+    // Arrange
+    std::shared_ptr<Texture> straight = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Act
+    loader_ptr->set_alpha_mode(penguin::rendering::primitives::AlphaMode::Premultiplied);
+    std::shared_ptr<Texture> premultiplied = loader_ptr->load(renderer_ptr->get_native_ptr(), abs_path.c_str());
+
+    // Assert
+    ASSERT_NE(premultiplied, nullptr);
+    EXPECT_NE(straight, premultiplied);
+    EXPECT_EQ(penguin::rendering::primitives::AlphaMode::Premultiplied, premultiplied->get_alpha_mode());
+    EXPECT_EQ(2u, loader_ptr->get_stats().entries);
+}
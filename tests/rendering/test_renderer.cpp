@@ -316,6 +316,46 @@ TEST_F(RendererTestFixture, DrawText_WithValidParams_RendererRemainsValid) {
     EXPECT_TRUE(renderer_ptr->is_valid());
 }
 
+TEST_F(RendererTestFixture, DrawText_WithWrappedText_RendererRemainsValid) {
+    // Arrange
+    text_ptr->set_string("the quick brown fox\n\njumps over the lazy dog");
+    text_ptr->set_wrap_width(80);
+    text_ptr->set_alignment(penguin::rendering::primitives::TextAlignment::Center);
+
+    // Act
+    renderer_ptr->draw_text(*text_ptr);
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_valid());
+    EXPECT_TRUE(renderer_ptr->is_valid());
+}
+
+TEST_F(RendererTestFixture, DrawText_WithScaledText_RendererRemainsValid) {
+    // Arrange
+    text_ptr->set_scale(3.0f);
+
+    // Act
+    renderer_ptr->draw_text(*text_ptr);
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+    renderer_ptr->draw_text(*text_ptr);
+
+    // Assert
+    EXPECT_FLOAT_EQ(3.0f, text_ptr->get_scale());
+    EXPECT_TRUE(renderer_ptr->is_valid());
+}
+
+TEST_F(RendererTestFixture, DrawText_WithBakedText_RendererRemainsValid) {
+    // Arrange
+    text_ptr->bake(renderer_ptr->get_native_ptr());
+
+    // Act
+    renderer_ptr->draw_text(*text_ptr);
+
+    // Assert
+    EXPECT_TRUE(text_ptr->is_baked());
+    EXPECT_TRUE(renderer_ptr->is_valid());
+}
+
 TEST_F(RendererTestFixture, GetNativePtr_WithValidRenderer_ReturnsNonNullPtr) {
     // Arrange (done in SetUp)
 
@@ -0,0 +1,61 @@
+// penguin_logdecode: renders a binary log written by Logger::open_binary_log() as text, in the text log's format.
+//
+// Usage: penguin_logdecode <input.pflog> [output.txt]
+//
+// Without an output file the text is written to stdout.
+
+#include <logger/internal/binary_log.hpp>
+#include <logger/internal/logger_impl.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char** argv) {
+	if (argc != 2 && argc != 3) {
+		std::cerr << "Usage: penguin_logdecode <input.pflog> [output.txt]\n";
+		return 1;
+	}
+
+	penguin::internal::log::BinaryLogReader reader;
+	if (!reader.open(argv[1])) {
+		std::cerr << "penguin_logdecode: '" << argv[1] << "' is not a binary log (or was written with another byte order)\n";
+		return 1;
+	}
+
+	std::ofstream output_file;
+	if (argc == 3) {
+		output_file.open(argv[2]);
+		if (!output_file) {
+			std::cerr << "penguin_logdecode: failed to write '" << argv[2] << "'\n";
+			return 1;
+		}
+	}
+
+	std::ostream& output = argc == 3 ? output_file : std::cout;
+
+	penguin::internal::log::DecodedLogEvent event;
+	penguin::internal::log::LogEntry entry;
+	std::size_t count = 0;
+
+	while (reader.next(event)) {
+		entry.timestamp = std::chrono::system_clock::time_point(
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(event.timestamp_ns)));
+		entry.level = event.level;
+		entry.message = std::move(event.message);
+		entry.file = std::filesystem::path(event.file).filename().string();
+		entry.line = event.line;
+		entry.column = event.column;
+		entry.function = std::move(event.function);
+
+		output << penguin::internal::log::LoggerImpl::format_log_entry(entry) << '\n';
+		++count;
+	}
+
+	if (reader.is_truncated()) {
+		std::cerr << "penguin_logdecode: the log is truncated or corrupt after " << count << " entries\n";
+		return 2;
+	}
+
+	return 0;
+}
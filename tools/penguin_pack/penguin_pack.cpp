@@ -0,0 +1,61 @@
+// penguin_pack: packs a directory of assets into a single archive that AssetManager::mount_archive() can read.
+//
+// Usage: penguin_pack <output.pfpk> <input directory>
+//
+// Every regular file under the input directory is stored under its path relative to that directory,
+// e.g. assets/textures/player.png packed from assets/ is loaded as "<mount point>/textures/player.png".
+
+#include <rendering/systems/internal/asset_archive.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv) {
+	if (argc != 3) {
+		std::cerr << "Usage: penguin_pack <output.pfpk> <input directory>\n";
+		return 1;
+	}
+
+	const fs::path output = argv[1];
+	const fs::path input = argv[2];
+
+	std::error_code ec;
+	if (!fs::is_directory(input, ec)) {
+		std::cerr << "penguin_pack: '" << input.string() << "' is not a directory\n";
+		return 1;
+	}
+
+	penguin::internal::rendering::systems::AssetArchiveWriter writer;
+	std::size_t total_bytes = 0;
+
+	for (const fs::directory_entry& entry : fs::recursive_directory_iterator(input)) {
+		if (!entry.is_regular_file() || fs::equivalent(entry.path(), output, ec)) {
+			continue; // skip directories and the archive itself when packing in place
+		}
+
+		std::ifstream file(entry.path(), std::ios::binary);
+		if (!file) {
+			std::cerr << "penguin_pack: failed to read '" << entry.path().string() << "'\n";
+			return 1;
+		}
+
+		std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		total_bytes += data.size();
+
+		writer.add(fs::relative(entry.path(), input).generic_string(), std::move(data));
+	}
+
+	if (!writer.write(output.string().c_str())) {
+		std::cerr << "penguin_pack: failed to write '" << output.string() << "'\n";
+		return 1;
+	}
+
+	std::cout << "penguin_pack: packed " << writer.get_entry_count() << " files (" << total_bytes << " bytes) into " << output.string() << "\n";
+
+	return 0;
+}